@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*  bench_util.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+// Small helpers shared by the gdsynth_bench modes.
+
+using BenchClock = std::chrono::steady_clock;
+
+inline double elapsedMicros(BenchClock::time_point from, BenchClock::time_point to) {
+    return std::chrono::duration<double, std::micro>(to - from).count();
+}
+
+// Nearest-rank percentile (p in 0..100). 'samples' is sorted in place.
+inline double percentile(std::vector<double> &samples, double p) {
+    if (samples.empty()) return 0.0;
+    std::sort(samples.begin(), samples.end());
+    size_t rank = (size_t)(p / 100.0 * (double)(samples.size() - 1) + 0.5);
+    if (rank >= samples.size()) rank = samples.size() - 1;
+    return samples[rank];
+}
+
+// Per-buffer latency summary printed by every render mode.
+inline void printLatencySummary(const char *label, std::vector<double> samples, double budgetMicros) {
+    int32_t overBudget = 0;
+    for (double v : samples) {
+        if (v > budgetMicros) overBudget++;
+    }
+    std::printf("%s latency(us): p50 %.1f  p90 %.1f  p99 %.1f  max %.1f  (budget %.1f, over %d/%d)\n",
+                label,
+                percentile(samples, 50.0), percentile(samples, 90.0),
+                percentile(samples, 99.0), percentile(samples, 100.0),
+                budgetMicros, overBudget, (int32_t)samples.size());
+}
+
+// Builds a format 1 SMF in memory so the benchmark runs without external content.
+// Every track plays 'chordSize' notes per beat with its own program, which keeps
+// the voice pool close to saturation.
+// Hardware branch-miss counter for the calling thread (Linux perf events).
+// valid() is false where perf events are not available (other systems,
+// perf_event_paranoid, virtual machines without a PMU).
+class BranchMissCounter {
+public:
+    BranchMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+    ~BranchMissCounter() {
+#if defined(__linux__)
+        if (fd >= 0) close(fd);
+#endif
+    }
+    BranchMissCounter(const BranchMissCounter &) = delete;
+    BranchMissCounter &operator=(const BranchMissCounter &) = delete;
+
+    bool valid() const { return fd >= 0; }
+    void start() {
+#if defined(__linux__)
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+    // misses since start()
+    int64_t stop() {
+        int64_t count = 0;
+#if defined(__linux__)
+        if (fd < 0) return 0;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) count = 0;
+#endif
+        return count;
+    }
+
+private:
+    int fd = -1;
+};
+
+class SyntheticSMF {
+private:
+    std::vector<uint8_t> data;
+
+    void putBytes(uint32_t value, int32_t length, std::vector<uint8_t> &out) {
+        for (int32_t i = length - 1; i >= 0; i--) out.push_back((uint8_t)((value >> (8 * i)) & 0xff));
+    }
+    void putVarLen(uint32_t value, std::vector<uint8_t> &out) {
+        uint8_t buf[5];
+        int32_t n = 0;
+        buf[n++] = value & 0x7f;
+        while ((value >>= 7) != 0) buf[n++] = (uint8_t)((value & 0x7f) | 0x80);
+        while (n > 0) out.push_back(buf[--n]);
+    }
+    void putTrack(const std::vector<uint8_t> &body) {
+        data.insert(data.end(), {'M', 'T', 'r', 'k'});
+        putBytes((uint32_t)body.size(), 4, data);
+        data.insert(data.end(), body.begin(), body.end());
+    }
+
+public:
+    SyntheticSMF(int32_t numTracks, int32_t chordSize, int32_t beats, int32_t bpm) {
+        const uint32_t division = 480;
+        data.insert(data.end(), {'M', 'T', 'h', 'd'});
+        putBytes(6, 4, data);
+        putBytes(1, 2, data);
+        putBytes((uint32_t)numTracks + 1, 2, data);
+        putBytes(division, 2, data);
+
+        { // conductor track
+            std::vector<uint8_t> body;
+            putVarLen(0, body);
+            body.insert(body.end(), {0xff, 0x51, 0x03});
+            putBytes(60000000u / (uint32_t)bpm, 3, body);
+            putVarLen(0, body);
+            body.insert(body.end(), {0xff, 0x2f, 0x00});
+            putTrack(body);
+        }
+        for (int32_t t = 0; t < numTracks; t++) {
+            std::vector<uint8_t> body;
+            uint8_t channel = (uint8_t)(t % 16);
+            putVarLen(0, body);
+            body.push_back(0xc0 | channel);
+            body.push_back((uint8_t)((t * 7) % 0x70));
+            for (int32_t b = 0; b < beats; b++) {
+                int32_t root = 36 + ((t * 5 + b * 3) % 48);
+                for (int32_t n = 0; n < chordSize; n++) {
+                    putVarLen(0, body);
+                    body.push_back(0x90 | channel);
+                    body.push_back((uint8_t)(root + n * 4));
+                    body.push_back((uint8_t)(64 + (b * 13 + n * 7) % 63));
+                }
+                for (int32_t n = 0; n < chordSize; n++) {
+                    putVarLen(n == 0 ? division : 0, body);
+                    body.push_back(0x80 | channel);
+                    body.push_back((uint8_t)(root + n * 4));
+                    body.push_back(0);
+                }
+            }
+            putVarLen(0, body);
+            body.insert(body.end(), {0xff, 0x2f, 0x00});
+            putTrack(body);
+        }
+    }
+    const uint8_t *bytes() const { return data.data(); }
+    size_t size() const { return data.size(); }
+};
+
+// gdsynth_bench --wavetables, see wave_quality.cpp
+int32_t runWaveQuality(double rate);
+
+#endif // BENCH_UTIL_H
@@ -0,0 +1,767 @@
+/**************************************************************************/
+/*  gdsynth_bench.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Headless render benchmark for the synthesis core.
+//
+//   gdsynth_bench [options] [file.mid]
+//
+// Renders an SMF (or a built-in synthetic one) through Sequencer::feed() as fast
+// as possible and reports throughput, real-time factor and per-buffer latency.
+// --compare renders the song twice, with the scalar reference path and with the
+// selected voice kernel, and reports the speedup and the output difference.
+// --wavetables reports the aliasing and size of the wave tables instead.
+// --render-thread renders on a RenderThread and drains its ring in real time.
+// --scaling renders the song with 1 .. N voice rendering threads.
+// --voices-sweep renders the song with voice pools of several sizes.
+// --instances renders several sequencers through the shared RenderEngine.
+// --load times SMF loading from a file and from memory instead of rendering.
+// --seek checks SMFParser::seek() at random positions against a replay from tick 0.
+
+#include "bench_util.hpp"
+#include "sequencer.hpp"
+#include "render_thread.hpp"
+#include "render_engine.hpp"
+#include "smfparser.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct BenchOptions {
+    std::string smfPath;
+    std::string wavPath;
+    double rate = 44100.0;
+    double bufferMs = 50.0;     // same as GDSynthesizer (buffer_length/2)
+    double seconds = 60.0;      // rendered audio length
+    float division = 4.0f;
+    float preOnTime = 0.0f;
+    float masterKnee = 1.0f;
+    int32_t controlRate = 1;
+    int32_t renderThreads = 1;
+    float cullLevel = -100.0f;
+    bool scaling = false;
+    int32_t polyphony = Sequencer::defaultPolyphony;
+    bool voicesSweep = false;
+    int32_t instances = 0;      // > 0: --instances, sequencers rendered by the RenderEngine
+    int32_t engineThreads = 0;  // RenderEngine threads, 0: all cores
+    int32_t loadRepeat = 0;     // > 0: --load, times each way of loading the song is repeated
+    int32_t seekCount = 0;      // > 0: --seek, random positions checked
+    int32_t synthTracks = 8;
+    int32_t synthChord = 4;
+    RenderKernel kernel = RenderKernel::RK_AUTO;
+    bool compare = false;
+    bool wavetables = false;
+    int32_t feedFrames = 0;     // samples per feed() call, 0: one buffer, -1: random 1 .. 2 buffers
+    int32_t renderThreadMs = 0; // > 0: ring depth of --render-thread
+    double stallMs = 0.0;       // --render-thread: lock the sequencer this long once per second
+    int32_t modulation = 0;     // 0: as in the instruments, 1: none, 2: FM and frequency noise on every instrument
+};
+
+static const char *kernelNames[] = {"auto", "scalar", "sse2", "avx2", "avx512", "simd128", "generic"};
+static const char *modulationNames[] = {"song", "off", "on"};
+
+static void printUsage(const char *name) {
+    std::printf("usage: %s [options] [file.mid]\n", name);
+    std::printf("  --rate <hz>          sampling rate (default 44100)\n");
+    std::printf("  --buffer-ms <ms>     render block length (default 50)\n");
+    std::printf("  --seconds <s>        audio length to render (default 60)\n");
+    std::printf("  --division <n>       divisionNum control param (default 4)\n");
+    std::printf("  --pre-on <ms>        preOnTime control param (default 0)\n");
+    std::printf("  --knee <level>       masterKnee control param, 1 = hard clip (default 1)\n");
+    std::printf("  --tracks <n>         synthetic SMF: number of tracks (default 8)\n");
+    std::printf("  --chord <n>          synthetic SMF: notes per beat and track (default 4)\n");
+    std::printf("  --kernel <name>      auto|scalar|sse2|avx2|avx512|simd128|generic (default auto)\n");
+    std::printf("  --control-rate <n>   controlRate control param, 1..32 samples (default 1)\n");
+    std::printf("  --cull <dB>          cullLevel control param, -200 = off (default -100)\n");
+    std::printf("  --threads <n>        renderThreads control param, voice rendering threads (default 1)\n");
+    std::printf("  --scaling            render with 1 .. --threads (default: all cores) threads and compare\n");
+    std::printf("  --voices <n>         voice pool size, the max_note of init_synthe (default 64)\n");
+    std::printf("  --voices-sweep       render with 16, 64, 256 and 1024 voices\n");
+    std::printf("  --instances <n>      render n sequencers through the shared engine, 1 thread vs --engine-threads\n");
+    std::printf("  --engine-threads <n> engine threads for --instances (default: all cores)\n");
+    std::printf("  --load <n>           load the song n times from a file and from memory instead of rendering\n");
+    std::printf("                       (the synthetic SMF is 16 times longer here)\n");
+    std::printf("  --seek <n>           seek to n random positions and compare the held notes with a\n");
+    std::printf("                       replay from tick 0 (both sequences with --pre-on)\n");
+    std::printf("  --feed <n|random>    samples per feed() call, like feed_data with a varying frame rate\n");
+    std::printf("                       (default: one buffer)\n");
+    std::printf("  --compare            also render with the scalar path and compare\n");
+    std::printf("  --mod <mode>         pitch modulation: song|off|on (default song)\n");
+    std::printf("  --wav <path>         also write the rendered audio as 32-bit float WAV\n");
+    std::printf("  --wavetables         report wave table aliasing and size instead of rendering\n");
+    std::printf("  --render-thread <ms> render on a thread into a ring of this depth, drained in real time\n");
+    std::printf("  --stall-ms <ms>      with --render-thread: block the render thread this long every second\n");
+    std::printf("without file.mid a synthetic SMF is rendered.\n");
+}
+
+static bool parseOptions(int argc, char **argv, BenchOptions &opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto next = [&](double &value) {
+            if (i + 1 >= argc) return false;
+            value = std::atof(argv[++i]);
+            return true;
+        };
+        double v = 0.0;
+        if (arg == "--rate") { if (!next(opt.rate)) return false; }
+        else if (arg == "--buffer-ms") { if (!next(opt.bufferMs)) return false; }
+        else if (arg == "--seconds") { if (!next(opt.seconds)) return false; }
+        else if (arg == "--division") { if (!next(v)) return false; opt.division = (float)v; }
+        else if (arg == "--pre-on") { if (!next(v)) return false; opt.preOnTime = (float)v; }
+        else if (arg == "--control-rate") { if (!next(v)) return false; opt.controlRate = (int32_t)v; }
+        else if (arg == "--cull") { if (!next(v)) return false; opt.cullLevel = (float)v; }
+        else if (arg == "--threads") { if (!next(v)) return false; opt.renderThreads = (int32_t)v; }
+        else if (arg == "--scaling") opt.scaling = true;
+        else if (arg == "--voices") { if (!next(v)) return false; opt.polyphony = std::clamp((int32_t)v, 1, Sequencer::maxPolyphony); }
+        else if (arg == "--voices-sweep") opt.voicesSweep = true;
+        else if (arg == "--instances") { if (!next(v)) return false; opt.instances = std::clamp((int32_t)v, 1, 256); }
+        else if (arg == "--engine-threads") { if (!next(v)) return false; opt.engineThreads = (int32_t)v; }
+        else if (arg == "--load") { if (!next(v)) return false; opt.loadRepeat = std::max((int32_t)v, 1); }
+        else if (arg == "--seek") { if (!next(v)) return false; opt.seekCount = std::max((int32_t)v, 1); }
+        else if (arg == "--knee") { if (!next(v)) return false; opt.masterKnee = (float)v; }
+        else if (arg == "--tracks") { if (!next(v)) return false; opt.synthTracks = (int32_t)v; }
+        else if (arg == "--chord") { if (!next(v)) return false; opt.synthChord = (int32_t)v; }
+        else if (arg == "--wav") { if (i + 1 >= argc) return false; opt.wavPath = argv[++i]; }
+        else if (arg == "--kernel") {
+            if (i + 1 >= argc) return false;
+            std::string name = argv[++i];
+            int32_t k = 0;
+            while (k < (int32_t)RenderKernel::RK_TAIL && name != kernelNames[k]) k++;
+            if (k == (int32_t)RenderKernel::RK_TAIL) return false;
+            opt.kernel = (RenderKernel)k;
+        }
+        else if (arg == "--feed") {
+            if (i + 1 >= argc) return false;
+            std::string count = argv[++i];
+            opt.feedFrames = (count == "random") ? -1 : std::atoi(count.c_str());
+            if (opt.feedFrames == 0) return false;
+        }
+        else if (arg == "--compare") opt.compare = true;
+        else if (arg == "--wavetables") opt.wavetables = true;
+        else if (arg == "--render-thread") { if (!next(v)) return false; opt.renderThreadMs = (int32_t)v; }
+        else if (arg == "--stall-ms") { if (!next(opt.stallMs)) return false; }
+        else if (arg == "--mod") {
+            if (i + 1 >= argc) return false;
+            std::string name = argv[++i];
+            int32_t m = 0;
+            while (m < 3 && name != modulationNames[m]) m++;
+            if (m == 3) return false;
+            opt.modulation = m;
+        }
+        else if (arg == "-h" || arg == "--help") return false;
+        else if (!arg.empty() && arg[0] == '-') return false;
+        else opt.smfPath = arg;
+    }
+    return opt.rate > 0.0 && opt.bufferMs > 0.0 && opt.seconds > 0.0;
+}
+
+// decoded apart and swapped in, as GDSynthesizer::loadMidi() does
+static bool loadSong(Sequencer &sequencer, const BenchOptions &opt) {
+    SMFParser parsed;
+    bool ok = false;
+    if (!opt.smfPath.empty()) {
+        ok = parsed.load(opt.smfPath.c_str());
+    } else {
+        SyntheticSMF smf(opt.synthTracks, opt.synthChord, 512, 120);
+        ok = parsed.load(smf.bytes(), smf.size());
+    }
+    sequencer.smfAdopt(parsed, 60000.0);
+    return ok;
+}
+
+static void writeWav(const std::string &path, const std::vector<float> &samples, int32_t rate) {
+    FILE *fp = std::fopen(path.c_str(), "wb");
+    if (fp == nullptr) {
+        std::printf("cannot open %s\n", path.c_str());
+        return;
+    }
+    auto put32 = [fp](uint32_t v) { std::fwrite(&v, 4, 1, fp); };
+    auto put16 = [fp](uint16_t v) { std::fwrite(&v, 2, 1, fp); };
+    uint32_t dataBytes = (uint32_t)(samples.size() * sizeof(float));
+    std::fwrite("RIFF", 1, 4, fp); put32(36 + dataBytes);
+    std::fwrite("WAVEfmt ", 1, 8, fp); put32(16);
+    put16(3); put16(1); put32((uint32_t)rate); put32((uint32_t)rate * 4); put16(4); put16(32);
+    std::fwrite("data", 1, 4, fp); put32(dataBytes);
+    std::fwrite(samples.data(), sizeof(float), samples.size(), fp);
+    std::fclose(fp);
+}
+
+struct RenderResult {
+    int32_t bufferSamples = 0;
+    int32_t numBuffers = 0;
+    int32_t peakVoices = 0;
+    double voiceSum = 0.0;
+    int64_t noteEvents = 0;
+    int64_t stolenTones = 0;
+    int64_t engineBatches = 0;  // --instances: RenderEngine render passes
+    CullStats cull;
+    double wallMicros = 0.0;
+    double initMicros = 0.0;    // Sequencer construction + initParam(), what init_synthe waits for
+    double readyMicros = 0.0;   // until the LUTs built in the background are ready
+    size_t voiceMemory = 0;     // Sequencer::getVoiceMemory()
+    int64_t branchMisses = -1;  // -1: not available
+    std::string kernelName;
+    int32_t controlRate = 1;
+    std::vector<double> latencies;
+    std::vector<float> wav;
+};
+
+// --mod off/on: strip or force FM and frequency noise to measure the pitch
+// modulation cost.
+static void applyModulation(Sequencer &sequencer, int32_t modulation) {
+    if (modulation == 0) return;
+    std::array<Instrument, Sequencer::numinstruments> instruments = sequencer.getInstruments();
+    for (Instrument &inst : instruments) {
+        if (modulation == 1) {
+            inst.fmFreq = 0.0f;
+            inst.freqNoiseCentRange = 0.0f;
+        } else {
+            inst.fmFreq = 6.0f;
+            inst.fmCentRange = 30.0f;
+            inst.freqNoiseCentRange = 10.0f;
+        }
+    }
+    sequencer.setInstruments(instruments);
+}
+
+// initParam, control params and song, as init_synthe / set_control_params / load_midi do.
+// Startup times are taken from 'initBegin', before the Sequencer was constructed.
+static bool setupSequencer(const BenchOptions &opt, RenderKernel kernel, Sequencer &sequencer,
+                           BenchClock::time_point initBegin, RenderResult &result) {
+    int32_t bufferSamples = (int32_t)(opt.rate * opt.bufferMs / 1000.0);
+    if (!sequencer.initParam(opt.rate, opt.bufferMs / 1000.0, bufferSamples, opt.polyphony)) {
+        std::printf("initParam failed\n");
+        return false;
+    }
+    result.initMicros = elapsedMicros(initBegin, BenchClock::now());
+    SharedLUT::getInstance().waitReady();
+    result.readyMicros = elapsedMicros(initBegin, BenchClock::now());
+    ControlParams params = sequencer.getControlParams();
+    params.divisionNum = opt.division;
+    params.preOnTime = opt.preOnTime;
+    params.renderKernel = kernel;
+    params.masterKnee = opt.masterKnee;
+    params.controlRate = opt.controlRate;
+    params.renderThreads = opt.renderThreads;
+    params.cullLevel = opt.cullLevel;
+    sequencer.setControlParams(params);
+    applyModulation(sequencer, opt.modulation);
+    if (!loadSong(sequencer, opt)) {
+        std::printf("failed to load %s\n", opt.smfPath.empty() ? "synthetic SMF" : opt.smfPath.c_str());
+        return false;
+    }
+    result.bufferSamples = bufferSamples;
+    result.voiceMemory = sequencer.getVoiceMemory();
+    return true;
+}
+
+static bool renderSong(const BenchOptions &opt, RenderKernel kernel, bool keepAudio, RenderResult &result) {
+    auto initBegin = BenchClock::now();
+    Sequencer sequencer;
+    if (!setupSequencer(opt, kernel, sequencer, initBegin, result)) return false;
+    int32_t bufferSamples = result.bufferSamples;
+
+    sequencer.emitSignal = [&result](const EmittedEvent &ev) {
+        if (ev.msg == 0) result.noteEvents++;
+    };
+
+    result.numBuffers = (int32_t)(opt.seconds * 1000.0 / opt.bufferMs);
+    result.kernelName = sequencer.getRenderKernelName();
+    result.controlRate = sequencer.getControlParams().controlRate;
+    const int64_t totalSamples = (int64_t)result.numBuffers * bufferSamples;
+    std::vector<float> pcm((size_t)std::max(bufferSamples * 2, opt.feedFrames));
+    std::mt19937 feedRandom(1);
+    std::uniform_int_distribution<int32_t> randomFeed(1, bufferSamples * 2);
+    result.latencies.reserve(result.numBuffers);
+    if (keepAudio) result.wav.reserve((size_t)totalSamples);
+
+    BranchMissCounter branchMisses;
+    auto begin = BenchClock::now();
+    branchMisses.start();
+    for (int64_t done = 0; done < totalSamples;) {
+        int32_t count = (opt.feedFrames == 0) ? bufferSamples
+                      : (opt.feedFrames > 0) ? opt.feedFrames : randomFeed(feedRandom);
+        count = (int32_t)std::min((int64_t)count, totalSamples - done);
+        auto t0 = BenchClock::now();
+        sequencer.feed(pcm.data(), count);
+        auto t1 = BenchClock::now();
+        result.latencies.push_back(elapsedMicros(t0, t1));
+        // voice statistics are per buffer worth of samples
+        int32_t voices = sequencer.getActiveToneCount();
+        result.voiceSum += (double)voices * (double)count / (double)bufferSamples;
+        if (voices > result.peakVoices) result.peakVoices = voices;
+        if (keepAudio) result.wav.insert(result.wav.end(), pcm.begin(), pcm.begin() + count);
+        done += count;
+    }
+    int64_t misses = branchMisses.stop();
+    result.wallMicros = elapsedMicros(begin, BenchClock::now());
+    result.stolenTones = sequencer.getStolenToneCount();
+    result.cull = sequencer.getCullStats();
+    if (branchMisses.valid()) result.branchMisses = misses;
+    return true;
+}
+
+static void compareAudio(const std::vector<float> &reference, const std::vector<float> &test) {
+    double maxDiff = 0.0;
+    double signal = 0.0;
+    double noise = 0.0;
+    for (size_t i = 0; i < reference.size() && i < test.size(); i++) {
+        double d = (double)test[i] - (double)reference[i];
+        if (std::fabs(d) > maxDiff) maxDiff = std::fabs(d);
+        signal += (double)reference[i] * (double)reference[i];
+        noise += d * d;
+    }
+    if (noise == 0.0) {
+        std::printf("vs scalar: bit-exact\n");
+        return;
+    }
+    std::printf("vs scalar: max diff %.3g  SNR %.1f dB\n", maxDiff, 10.0 * std::log10(signal / noise));
+}
+
+// Branch misses include the copy of the audio for --wav / --compare, which is
+// the same for both paths.
+static void printBranchMisses(const char *label, const RenderResult &result) {
+    if (result.branchMisses < 0) {
+        std::printf("%sbranch misses: n/a (perf events unavailable)\n", label);
+        return;
+    }
+    double voiceSamples = result.voiceSum * (double)result.bufferSamples;
+    std::printf("%sbranch misses: %lld (%.3f per voice-sample)\n", label, (long long)result.branchMisses,
+                (voiceSamples > 0.0) ? (double)result.branchMisses / voiceSamples : 0.0);
+}
+
+static int32_t runRender(const BenchOptions &opt) {
+    RenderResult result;
+    bool keepAudio = opt.compare || !opt.wavPath.empty();
+    if (!renderSong(opt, opt.kernel, keepAudio, result)) return 1;
+
+    double samples = (double)result.numBuffers * (double)result.bufferSamples;
+    double audioSeconds = samples / opt.rate;
+    std::printf("song: %s\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str());
+    std::printf("rate %.0f Hz, buffer %d samples (%.1f ms), %d buffers\n",
+                opt.rate, result.bufferSamples, opt.bufferMs, result.numBuffers);
+    std::printf("kernel: %s, control rate %d, %d render thread(s)\n", result.kernelName.c_str(), result.controlRate, opt.renderThreads);
+    std::printf("startup: initParam %.2f ms, tables ready after %.2f ms\n",
+                result.initMicros / 1000.0, result.readyMicros / 1000.0);
+    std::printf("voices: pool %d (%.1f KiB)  peak %d  mean %.1f  note events %lld  stolen %lld\n",
+                opt.polyphony, (double)result.voiceMemory / 1024.0, result.peakVoices,
+                result.voiceSum / (double)result.numBuffers, (long long)result.noteEvents, (long long)result.stolenTones);
+    const CullStats &cull = result.cull;
+    const double voiceSamples = (double)(cull.renderedVoiceSamples + cull.skippedVoiceSamples);
+    std::printf("culling at %.0f dB: %lld voices, %lld voice-samples skipped (%.1f%%), %lld delay tail samples skipped\n",
+                opt.cullLevel, (long long)cull.culledVoices, (long long)cull.skippedVoiceSamples,
+                (voiceSamples > 0.0) ? 100.0 * (double)cull.skippedVoiceSamples / voiceSamples : 0.0,
+                (long long)cull.skippedDelaySamples);
+    std::printf("rendered %.1f s of audio in %.3f s\n", audioSeconds, result.wallMicros / 1e6);
+    std::printf("throughput: %.0f samples/s\n", samples / (result.wallMicros / 1e6));
+    std::printf("real-time factor: %.2fx\n", audioSeconds / (result.wallMicros / 1e6));
+    if (result.voiceSum > 0.0) {
+        std::printf("voice cost: %.1f ns per voice-sample (modulation: %s)\n",
+                    result.wallMicros * 1000.0 / (result.voiceSum * (double)result.bufferSamples),
+                    modulationNames[opt.modulation]);
+    }
+    printBranchMisses("", result);
+    printLatencySummary("feed", result.latencies, opt.bufferMs * 1000.0);
+
+    if (opt.compare) {
+        RenderResult reference;
+        if (!renderSong(opt, RenderKernel::RK_SCALAR, true, reference)) return 1;
+        std::printf("scalar: real-time factor %.2fx, speedup %.2fx\n",
+                    audioSeconds / (reference.wallMicros / 1e6), reference.wallMicros / result.wallMicros);
+        printBranchMisses("scalar ", reference);
+        compareAudio(reference.wav, result.wav);
+    }
+    if (!opt.wavPath.empty()) writeWav(opt.wavPath, result.wav, (int32_t)opt.rate);
+    return 0;
+}
+
+// gdsynth_bench --scaling: the same song with 1 .. N voice rendering threads.
+// The lane groups are reduced in a fixed order, so every thread count must
+// give the same samples as one thread.
+static int32_t runScaling(const BenchOptions &opt) {
+    int32_t maxThreads = (opt.renderThreads > 1) ? opt.renderThreads : (int32_t)std::thread::hardware_concurrency();
+    maxThreads = std::clamp(maxThreads, 1, (int32_t)WorkerPool::maxThreads);
+    std::printf("song: %s\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str());
+    std::printf("%8s %12s %9s %10s  %s\n", "threads", "samples/s", "rt factor", "speedup", "output");
+    RenderResult single;
+    bool identical = true;
+    for (int32_t threads = 1; threads <= maxThreads; threads++) {
+        BenchOptions run = opt;
+        run.renderThreads = threads;
+        RenderResult result;
+        if (!renderSong(run, opt.kernel, true, result)) return 1;
+        const double samples = (double)result.wav.size();
+        const double seconds = result.wallMicros / 1e6;
+        const char *output = "reference";
+        if (threads == 1) {
+            single = result;
+        } else {
+            const bool same = (result.wav == single.wav);
+            identical = identical && same;
+            output = same ? "bit-identical" : "DIFFERS";
+        }
+        std::printf("%8d %12.0f %8.2fx %9.2fx  %s\n", threads, samples / seconds, samples / opt.rate / seconds,
+                    single.wallMicros / result.wallMicros, output);
+    }
+    std::printf("kernel: %s, peak voices %d\n", single.kernelName.c_str(), single.peakVoices);
+    return identical ? 0 : 1;
+}
+
+// gdsynth_bench --voices-sweep: the same song with voice pools of several sizes.
+// A pool smaller than the song needs steals voices; the stolen count shows
+// where the pool stops limiting the song.
+static int32_t runVoicesSweep(const BenchOptions &opt) {
+    static const int32_t poolSizes[] = {16, 64, 256, 1024};
+    std::printf("song: %s\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str());
+    std::printf("%8s %12s %9s %12s %11s %12s %8s\n", "voices", "samples/s", "rt factor", "voice memory", "peak voices", "note events", "stolen");
+    std::string kernelName;
+    for (int32_t poolSize : poolSizes) {
+        BenchOptions run = opt;
+        run.polyphony = poolSize;
+        RenderResult result;
+        if (!renderSong(run, opt.kernel, false, result)) return 1;
+        const double samples = (double)result.numBuffers * (double)result.bufferSamples;
+        const double seconds = result.wallMicros / 1e6;
+        std::printf("%8d %12.0f %8.2fx %9.1f KiB %11d %12lld %8lld\n", poolSize, samples / seconds, samples / opt.rate / seconds,
+                    (double)result.voiceMemory / 1024.0, result.peakVoices, (long long)result.noteEvents, (long long)result.stolenTones);
+        kernelName = result.kernelName;
+    }
+    std::printf("kernel: %s, %d render thread(s)\n", kernelName.c_str(), opt.renderThreads);
+    return 0;
+}
+
+// Renders opt.instances sequencers through the RenderEngine with 'threads'
+// engine threads, pulling one buffer of each in turn like the audio thread
+// mixing several GDSynthesizer players. Keeps the audio of the first one.
+static bool renderInstances(const BenchOptions &opt, int32_t threads, RenderResult &result) {
+    const int32_t count = opt.instances;
+    std::vector<std::unique_ptr<Sequencer>> sequencers;
+    std::unique_ptr<std::mutex[]> mutexes = std::make_unique<std::mutex[]>((size_t)count);
+    std::vector<RenderEngine::Instance *> handles;
+    RenderEngine &engine = RenderEngine::getInstance();
+    engine.setThreads(threads);
+    for (int32_t i = 0; i < count; i++) {
+        sequencers.push_back(std::make_unique<Sequencer>());
+        if (!setupSequencer(opt, opt.kernel, *sequencers.back(), BenchClock::now(), result)) return false;
+        handles.push_back(engine.attach(*sequencers.back(), mutexes[i], result.bufferSamples));
+    }
+    const int32_t bufferSamples = result.bufferSamples;
+    result.numBuffers = (int32_t)(opt.seconds * 1000.0 / opt.bufferMs);
+    result.kernelName = sequencers[0]->getRenderKernelName();
+    result.wav.reserve((size_t)result.numBuffers * (size_t)bufferSamples);
+    result.latencies.reserve(result.numBuffers);
+    std::vector<float> pcm((size_t)bufferSamples);
+    const int64_t batchesBefore = engine.getStats().batches;
+
+    auto begin = BenchClock::now();
+    for (int32_t n = 0; n < result.numBuffers; n++) {
+        auto t0 = BenchClock::now();
+        for (int32_t i = 0; i < count; i++) {
+            engine.pull(handles[i], pcm.data(), bufferSamples);
+            if (i == 0) result.wav.insert(result.wav.end(), pcm.begin(), pcm.end());
+        }
+        result.latencies.push_back(elapsedMicros(t0, BenchClock::now()));
+    }
+    result.wallMicros = elapsedMicros(begin, BenchClock::now());
+    result.engineBatches = engine.getStats().batches - batchesBefore;
+    for (RenderEngine::Instance *handle : handles) engine.detach(handle);
+    return true;
+}
+
+// gdsynth_bench --instances <n>: n copies of the song rendered by the shared
+// engine, first on one thread and then batched over --engine-threads. Every
+// instance renders what it would alone, so both runs must give the same samples.
+static int32_t runInstances(const BenchOptions &opt) {
+    int32_t threads = (opt.engineThreads > 0) ? opt.engineThreads : (int32_t)std::thread::hardware_concurrency();
+    threads = std::clamp(threads, 1, (int32_t)WorkerPool::maxThreads);
+    std::printf("song: %s, %d instances\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str(), opt.instances);
+    std::printf("%8s %12s %9s %10s %9s  %s\n", "threads", "samples/s", "rt factor", "speedup", "batches", "output");
+    RenderResult single;
+    RenderResult batched;
+    bool identical = true;
+    for (int32_t run : {1, threads}) {
+        RenderResult result;
+        if (!renderInstances(opt, run, result)) return 1;
+        const double samples = (double)result.numBuffers * (double)result.bufferSamples * (double)opt.instances;
+        const double seconds = result.wallMicros / 1e6;
+        const char *output = "reference";
+        if (run == 1) {
+            single = result;
+        } else {
+            identical = (result.wav == single.wav);
+            output = identical ? "bit-identical" : "DIFFERS";
+        }
+        std::printf("%8d %12.0f %8.2fx %9.2fx %9lld  %s\n", run, samples / seconds, samples / opt.rate / seconds,
+                    single.wallMicros / result.wallMicros, (long long)result.engineBatches, output);
+        if (threads == 1) break;
+        batched = std::move(result);
+    }
+    std::printf("kernel: %s, render buffer %d samples\n", single.kernelName.c_str(), single.bufferSamples);
+    printLatencySummary("period", (threads == 1) ? single.latencies : batched.latencies, opt.bufferMs * 1000.0);
+    return identical ? 0 : 1;
+}
+
+// gdsynth_bench --render-thread <ms>: a RenderThread fills a ring of that depth
+// while this thread drains it in real time in 10 ms steps, like an audio
+// callback. --stall-ms holds the sequencer lock once per second, the way a slow
+// call from the game thread would, to show how much the ring absorbs.
+static int32_t runRenderThread(const BenchOptions &opt) {
+    RenderResult result;
+    Sequencer sequencer;
+    if (!setupSequencer(opt, opt.kernel, sequencer, BenchClock::now(), result)) return 1;
+    sequencer.emitSignal = [&result](const EmittedEvent &ev) {
+        if (ev.msg == 0) result.noteEvents++;
+    };
+    RenderThread renderThread(sequencer);
+    if (!renderThread.start(opt.renderThreadMs)) {
+        std::printf("render thread not available\n");
+        return 1;
+    }
+
+    const int32_t stepFrames = (int32_t)(opt.rate / 100.0);
+    const int32_t steps = (int32_t)(opt.seconds * 100.0);
+    std::vector<float> out(stepFrames);
+    std::vector<double> drainMicros;
+    drainMicros.reserve(steps);
+    int32_t minBuffered = INT32_MAX;
+    auto next = BenchClock::now();
+    auto nextStall = next + std::chrono::seconds(1);
+    std::vector<std::thread> stalls;
+    for (int32_t n = 0; n < steps; n++) {
+        next += std::chrono::milliseconds(10);
+        std::this_thread::sleep_until(next);
+        if (n > 0) minBuffered = std::min(minBuffered, renderThread.getStats().bufferedFrames);
+        auto t0 = BenchClock::now();
+        renderThread.drain(out.data(), stepFrames);
+        drainMicros.push_back(elapsedMicros(t0, BenchClock::now()));
+        if (opt.stallMs > 0.0 && BenchClock::now() >= nextStall) {
+            // the stall runs on a helper so this loop keeps draining on time
+            nextStall += std::chrono::seconds(1);
+            stalls.emplace_back([&renderThread, &opt]() {
+                std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+                std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(opt.stallMs * 1000.0)));
+            });
+        }
+    }
+    for (std::thread &stall : stalls) stall.join();
+    RenderStats stats = renderThread.getStats();
+    renderThread.stop();
+
+    std::printf("song: %s\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str());
+    std::printf("kernel: %s, render buffer %d samples, ring depth %d samples (%.1f ms), priority %s\n",
+                sequencer.getRenderKernelName(), result.bufferSamples, stats.depthFrames,
+                (double)stats.depthFrames * 1000.0 / opt.rate, stats.priorityRaised ? "raised" : "normal");
+    std::printf("drained %.1f s in 10 ms steps, stall %.1f ms per second\n", opt.seconds, opt.stallMs);
+    std::printf("rendered buffers %lld, note events %lld, dropped events %lld\n",
+                (long long)stats.renderedBuffers, (long long)result.noteEvents, (long long)stats.droppedEvents);
+    std::printf("underruns %lld (%lld samples), lowest ring fill %d samples\n",
+                (long long)stats.underruns, (long long)stats.underrunFrames, (minBuffered == INT32_MAX) ? 0 : minBuffered);
+    printLatencySummary("drain", drainMicros, 10000.0);
+    return (stats.underruns == 0) ? 0 : 1;
+}
+
+// gdsynth_bench --load: SMFParser::load() from a file (memory-mapped) and from
+// bytes in memory (as load_midi passes res:// files), against reading the file
+// one byte at a time as the parser used to.
+static int32_t runLoad(const BenchOptions &opt) {
+    std::string path = opt.smfPath;
+    bool temporary = false;
+    if (path.empty()) {
+        SyntheticSMF smf(opt.synthTracks, opt.synthChord, 512 * 16, 120);
+        path = (std::filesystem::temp_directory_path() / "gdsynth_bench_load.mid").string();
+        std::ofstream out(path, std::ios::binary);
+        out.write((const char *)smf.bytes(), (std::streamsize)smf.size());
+        if (!out) {
+            std::printf("cannot write %s\n", path.c_str());
+            return 1;
+        }
+        temporary = true;
+    }
+
+    std::vector<uint8_t> bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    SMFParser parser;
+    if (bytes.empty() || !parser.load(bytes.data(), bytes.size())) {
+        std::printf("failed to load %s\n", path.c_str());
+        if (temporary) std::filesystem::remove(path);
+        return 1;
+    }
+    const size_t numOfEvents = parser.getNumOfEvents();
+    const double megabytes = (double)bytes.size() / (1024.0 * 1024.0);
+
+    auto measure = [&](const char *label, auto &&load) {
+        std::vector<double> micros;
+        for (int32_t i = 0; i < opt.loadRepeat; i++) {
+            auto begin = BenchClock::now();
+            bool ok = load();
+            micros.push_back(elapsedMicros(begin, BenchClock::now()));
+            if (!ok || parser.getNumOfEvents() != numOfEvents) {
+                std::printf("%s: load failed\n", label);
+                return false;
+            }
+        }
+        std::sort(micros.begin(), micros.end());
+        const double median = micros[micros.size() / 2];
+        std::printf("%-22s median %8.2f ms  best %8.2f ms  %7.1f MiB/s\n", label,
+                    median / 1000.0, micros.front() / 1000.0, megabytes / (median / 1e6));
+        return true;
+    };
+
+    std::printf("song: %s\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str());
+    std::printf("%.2f MiB, %u tracks, %zu note events, %d loads each\n",
+                megabytes, parser.getNumOfTracks(), numOfEvents, opt.loadRepeat);
+    bool ok = measure("byte at a time + parse", [&]() {
+        std::ifstream in(path, std::ios::in | std::ios::binary);
+        in.seekg(0, std::ifstream::end);
+        const size_t size = (size_t)in.tellg();
+        in.seekg(0, std::ifstream::beg);
+        std::vector<uint8_t> copy(size);
+        for (size_t i = 0; i < size; i++) copy[i] = (uint8_t)in.get();
+        return parser.load(copy.data(), copy.size());
+    });
+    ok = ok && measure("mapped file", [&]() { return parser.load(path.c_str()); });
+    ok = ok && measure("memory", [&]() { return parser.load(bytes.data(), bytes.size()); });
+
+    if (temporary) std::filesystem::remove(path);
+    return ok ? 0 : 1;
+}
+
+// gdsynth_bench --seek: the held notes SMFParser::seek() restores from its
+// checkpoints, against parsing the song from tick 0 up to the same position
+// and pairing the note-offs as playback does (the last matching note-on for
+// the normal sequence, the first one for the pre-on sequence).
+static int32_t runSeek(const BenchOptions &opt) {
+    SMFParser parser;
+    parser.setPreOnTime(opt.preOnTime);
+    bool loaded = false;
+    if (!opt.smfPath.empty()) {
+        loaded = parser.load(opt.smfPath.c_str());
+    } else {
+        SyntheticSMF smf(opt.synthTracks, opt.synthChord, 512, 120);
+        loaded = parser.load(smf.bytes(), smf.size());
+    }
+    if (!loaded) {
+        std::printf("failed to load %s\n", opt.smfPath.c_str());
+        return 1;
+    }
+    const bool preOn = (opt.preOnTime > 0.0f);
+    const int32_t delay = preOn ? (int32_t)opt.preOnTime : 0;
+
+    auto replay = [&](int32_t till, bool forPreOnOff, std::vector<Note> &held) {
+        held.clear();
+        for (;;) {
+            Note note = parser.parse(till, forPreOnOff);
+            if (note.state == NState::NS_END || note.state == NState::NS_EMPTY) break;
+            if (note.state == NState::NS_ON_FOREVER) {
+                held.push_back(note);
+                continue;
+            }
+            auto matches = [&](const Note &on) { return on.channel == note.channel && on.key == note.key; };
+            if (forPreOnOff) {
+                auto it = std::find_if(held.begin(), held.end(), matches);
+                if (it != held.end()) held.erase(it);
+            } else {
+                auto it = std::find_if(held.rbegin(), held.rend(), matches);
+                if (it != held.rend()) held.erase(std::next(it).base());
+            }
+        }
+        return parser.parse(INT32_MAX, forPreOnOff); // the next event
+    };
+    auto same = [](const std::vector<Note> &a, const std::vector<Note> &b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const Note &x, const Note &y) {
+            return x.startTick == y.startTick && x.trackNum == y.trackNum && x.channel == y.channel && x.key == y.key;
+        });
+    };
+    auto sameNext = [](const Note &x, const Note &y) {
+        return x.state == y.state && (x.state == NState::NS_END || (x.startTick == y.startTick && x.key == y.key));
+    };
+
+    std::mt19937 rng(5);
+    int32_t mismatches = 0;
+    int32_t overCap = 0;
+    double seekMicros = 0.0;
+    double replayMicros = 0.0;
+    std::vector<Note> held, heldPreOnOff, expected, expectedPreOnOff;
+    for (int32_t n = 0; n < opt.seekCount; n++) {
+        const int32_t time = (int32_t)(rng() % (uint32_t)(parser.getLength() + 1));
+
+        auto begin = BenchClock::now();
+        parser.restart();
+        const Note expectedNext = replay(time + delay, false, expected);
+        Note expectedNextPreOn;
+        if (preOn) expectedNextPreOn = replay(time + delay, true, expectedPreOnOff);
+        replayMicros += elapsedMicros(begin, BenchClock::now());
+
+        begin = BenchClock::now();
+        parser.seek(time, held, heldPreOnOff);
+        seekMicros += elapsedMicros(begin, BenchClock::now());
+
+        // checkpoints keep the most recent maxPolyphony note-ons only
+        if (std::max(expected.size(), expectedPreOnOff.size()) > (size_t)Sequencer::maxPolyphony) {
+            overCap++;
+            continue;
+        }
+        bool ok = same(held, expected) && sameNext(parser.parse(INT32_MAX), expectedNext);
+        if (preOn) ok = ok && same(heldPreOnOff, expectedPreOnOff) && sameNext(parser.parse(INT32_MAX, true), expectedNextPreOn);
+        if (!ok) mismatches++;
+    }
+
+    std::printf("song: %s, %zu note events, %d ms\n", opt.smfPath.empty() ? "synthetic" : opt.smfPath.c_str(),
+                parser.getNumOfEvents(), parser.getLength());
+    std::printf("%d seeks%s: mean %.2f us, replay from tick 0 %.2f us\n", opt.seekCount,
+                preOn ? " (with the pre-on sequence)" : "", seekMicros / opt.seekCount, replayMicros / opt.seekCount);
+    std::printf("mismatches %d", mismatches);
+    if (overCap > 0) std::printf(", %d positions skipped with more than %d held notes", overCap, Sequencer::maxPolyphony);
+    std::printf("\n");
+    return (mismatches == 0) ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    BenchOptions opt;
+    if (!parseOptions(argc, argv, opt)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+    if (opt.wavetables) return runWaveQuality(opt.rate);
+    if (opt.renderThreadMs > 0) return runRenderThread(opt);
+    if (opt.scaling) return runScaling(opt);
+    if (opt.voicesSweep) return runVoicesSweep(opt);
+    if (opt.instances > 0) return runInstances(opt);
+    if (opt.loadRepeat > 0) return runLoad(opt);
+    if (opt.seekCount > 0) return runSeek(opt);
+    return runRender(opt);
+}
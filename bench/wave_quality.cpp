@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*  wave_quality.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// gdsynth_bench --wavetables: aliasing and size of the band-limited wave
+// mipmaps in SharedLUT against the former naive 32768-entry tables with the
+// key-tracked blend toward sine.
+//
+// Each wave is played at a frequency that fits a whole number of cycles into
+// the analysis window, so every harmonic lands on an exact FFT bin. Energy
+// outside the harmonic bins is aliasing (plus lookup noise) and is reported
+// relative to the harmonic energy.
+
+#include "bench_util.hpp"
+#include "sequencer.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr int32_t analysisSize = 16384;
+constexpr int32_t naiveSize = 32768;
+constexpr double twoPi = 2.0 * 3.1415926535897932384626433833;
+
+// The tables SharedLUT built before the mipmaps, sine first.
+std::vector<float> makeNaiveTables() {
+    const int32_t s = naiveSize;
+    std::vector<float> t((size_t)s * static_cast<int32_t>(BaseWave::WAVE_TAIL));
+    float *sine = &t[s * static_cast<int32_t>(BaseWave::WAVE_SIN)];
+    float *square = &t[s * static_cast<int32_t>(BaseWave::WAVE_SQUARE)];
+    float *triangle = &t[s * static_cast<int32_t>(BaseWave::WAVE_TRIANGLE)];
+    float *saw = &t[s * static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH)];
+    float *sinsaw = &t[s * static_cast<int32_t>(BaseWave::WAVE_SINSAWx2)];
+    for (int32_t i = 0; i < s; i++) {
+        sine[i] = sinf(2.0f * PI * (float)i / (float)s);
+        square[i] = (i < s / 2) ? 1.0f : -1.0f;
+        triangle[(i + 3 * s / 4) % s] = (i < s / 2) ? ((float)i * 4.0f) / ((float)s) - 1.0f : 3.0f - ((float)i * 4.0f) / ((float)s);
+        saw[(i + 3 * s / 4) % s] = ((float)i * 2.0f) / ((float)s) - 1.0f;
+    }
+    for (int32_t i = 0; i < s; i++) {
+        sinsaw[i] = ((sine[i] + 1.0f) + (saw[(i * 2) % s] + 1.0f)) / 2.0f - 1.0f;
+    }
+    return t;
+}
+
+void forwardFFT(std::vector<std::complex<double>> &x) {
+    const size_t n = x.size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(x[i], x[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double angle = -twoPi / (double)len;
+        const std::complex<double> step(std::cos(angle), std::sin(angle));
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; k++) {
+                const std::complex<double> u = x[i + k];
+                const std::complex<double> v = x[i + k + len / 2] * w;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= step;
+            }
+        }
+    }
+}
+
+// Energy off the harmonics of bin 'fundamental' relative to the energy on them, dB.
+double aliasLevel(const std::vector<float> &signal, int32_t fundamental) {
+    std::vector<std::complex<double>> x(signal.begin(), signal.end());
+    forwardFFT(x);
+    double harmonic = 0.0;
+    double other = 0.0;
+    for (int32_t bin = 1; bin < analysisSize / 2; bin++) {
+        const double e = std::norm(x[bin]);
+        if (bin % fundamental == 0) harmonic += e;
+        else other += e;
+    }
+    if (other <= 0.0) return -200.0;
+    return 10.0 * std::log10(other / harmonic);
+}
+
+} // namespace
+
+int32_t runWaveQuality(double rate) {
+    auto &lut = SharedLUT::getInstance();
+    lut.addRef();
+    auto begin = BenchClock::now();
+    if (!lut.initialize((float)rate, 4096)) {
+        lut.removeRef();
+        return 1;
+    }
+    lut.waitReady();
+    const double initMicros = elapsedMicros(begin, BenchClock::now());
+    const std::vector<float> naive = makeNaiveTables();
+    const float *mip = lut.getWaveMipLUT();
+
+    const BaseWave waves[] = {BaseWave::WAVE_SQUARE, BaseWave::WAVE_TRIANGLE, BaseWave::WAVE_SAWTOOTH, BaseWave::WAVE_SINSAWx2};
+    const char *waveNames[] = {"square", "triangle", "sawtooth", "sinsawx2"};
+    const int32_t keys[] = {24, 36, 48, 60, 72, 84, 96, 108, 120};
+
+    std::printf("rate %.0f Hz, window %d samples\n", rate, analysisSize);
+    std::printf("aliasing, dB relative to the harmonics (naive 32768 + key blend / mipmap):\n");
+    std::printf("key  freq(Hz) level");
+    for (const char *name : waveNames) std::printf("  %19s", name);
+    std::printf("\n");
+
+    std::vector<float> naiveOut(analysisSize);
+    std::vector<float> mipOut(analysisSize);
+    for (int32_t key : keys) {
+        const double target = 440.0 * std::pow(2.0, (key - 69) / 12.0);
+        const int32_t fundamental = std::max(1, (int32_t)std::lround(target * analysisSize / rate));
+        const double freq = fundamental * rate / analysisSize;
+        const double inc = twoPi * freq / rate;
+        const int32_t level = SharedLUT::getWaveMipLevel((float)inc);
+        const int32_t mipSize = SharedLUT::getWaveMipSize(level);
+        const float blend = std::clamp((float)key / 120.0f, 0.0f, 1.0f);
+        std::printf("%3d %9.1f %5d", key, freq, level);
+        for (BaseWave wave : waves) {
+            const float *naiveWave = &naive[(size_t)naiveSize * static_cast<int32_t>(wave)];
+            const float *mipWave = mip + SharedLUT::getWaveMipOffset(wave, level);
+            for (int32_t i = 0; i < analysisSize; i++) {
+                const double ph = std::fmod(inc * (i + 1), twoPi);
+                const int32_t n = (int32_t)(ph * (naiveSize / twoPi)) & (naiveSize - 1);
+                const float base = naiveWave[n];
+                naiveOut[i] = base + (naive[n] - base) * blend;
+                const double pos = ph * (mipSize / twoPi);
+                const int32_t m = (int32_t)pos;
+                const float frac = (float)(pos - m);
+                const float *g = mipWave + (m & (mipSize - 1));
+                mipOut[i] = g[0] + (g[1] - g[0]) * frac;
+            }
+            std::printf("  %8.1f / %8.1f", aliasLevel(naiveOut, fundamental), aliasLevel(mipOut, fundamental));
+        }
+        std::printf("\n");
+    }
+
+    const int32_t numWaves = static_cast<int32_t>(BaseWave::WAVE_TAIL);
+    const double naiveKB = (double)naiveSize * numWaves * sizeof(float) / 1024.0;
+    const double mipKB = (double)SharedLUT::getWaveMipLUTSize() * sizeof(float) / 1024.0;
+    std::printf("size: naive %.1f KB (%.1f KB per wave, two tables per voice)\n",
+                naiveKB, naiveKB / numWaves);
+    std::printf("      mipmap %.1f KB (%d levels, %.1f KB per wave, one level per voice: %.1f..%.1f KB)\n",
+                mipKB, SharedLUT::getWaveMipLevels(), mipKB / numWaves,
+                (SharedLUT::getWaveMipSize(SharedLUT::getWaveMipLevels() - 1) + 1) * sizeof(float) / 1024.0,
+                (SharedLUT::getWaveMipSize(0) + 1) * sizeof(float) / 1024.0);
+    std::printf("SharedLUT::initialize: %.1f ms\n", initMicros / 1000.0);
+    lut.removeRef();
+    return 0;
+}
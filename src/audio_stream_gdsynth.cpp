@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  audio_stream_gdsynth.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_stream_gdsynth.h"
+#include "gdsynthesizer.h"
+#include <godot_cpp/classes/audio_server.hpp>
+
+using namespace godot;
+
+void AudioStreamGDSynth::attach(GDSynthesizer *p_synth) {
+    std::lock_guard<std::mutex> lock(synthMutex);
+    synth = p_synth;
+}
+
+void AudioStreamGDSynth::detach() {
+    std::lock_guard<std::mutex> lock(synthMutex);
+    synth = nullptr;
+}
+
+void AudioStreamGDSynth::mix(AudioFrame *p_buffer, int32_t p_frames) {
+    std::lock_guard<std::mutex> lock(synthMutex);
+    if (synth == nullptr) {
+        for (int32_t i = 0; i < p_frames; i++) {
+            p_buffer[i].left = p_buffer[i].right = 0.0f;
+        }
+        return;
+    }
+    synth->mix(p_buffer, p_frames);
+}
+
+Ref<AudioStreamPlayback> AudioStreamGDSynth::_instantiate_playback() const {
+    Ref<AudioStreamPlaybackGDSynth> playback;
+    playback.instantiate();
+    playback->stream = Ref<AudioStreamGDSynth>(const_cast<AudioStreamGDSynth *>(this));
+    return playback;
+}
+
+String AudioStreamGDSynth::_get_stream_name() const {
+    return "GDSynth";
+}
+
+
+void AudioStreamPlaybackGDSynth::_start(double p_from_pos) {
+    active = true;
+    mixedFrames = 0;
+}
+
+void AudioStreamPlaybackGDSynth::_stop() {
+    active = false;
+}
+
+double AudioStreamPlaybackGDSynth::_get_playback_position() const {
+    return (double)mixedFrames / (double)AudioServer::get_singleton()->get_mix_rate();
+}
+
+int32_t AudioStreamPlaybackGDSynth::_mix(AudioFrame *p_buffer, float p_rate_scale, int32_t p_frames) {
+    if (!active || stream.is_null()) {
+        for (int32_t i = 0; i < p_frames; i++) {
+            p_buffer[i].left = p_buffer[i].right = 0.0f;
+        }
+        return p_frames;
+    }
+    stream->mix(p_buffer, p_frames);
+    mixedFrames += p_frames;
+    return p_frames;
+}
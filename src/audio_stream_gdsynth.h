@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  audio_stream_gdsynth.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_STREAM_GDSYNTH_H
+#define AUDIO_STREAM_GDSYNTH_H
+#include <godot_cpp/classes/audio_stream.hpp>
+#include <godot_cpp/classes/audio_stream_playback.hpp>
+#include <mutex>
+
+namespace godot {
+
+class GDSynthesizer;
+
+// Pull model output of a GDSynthesizer. The audio server calls _mix() of the
+// playback on its own thread at its mix rate, and the synthesizer renders
+// straight into the server's buffer.
+class AudioStreamGDSynth : public AudioStream {
+    GDCLASS(AudioStreamGDSynth, AudioStream);
+
+    std::mutex synthMutex;            // guards synth against the owner going away
+    GDSynthesizer *synth = nullptr;
+protected:
+    static void _bind_methods() {}
+public:
+    void attach(GDSynthesizer *p_synth);
+    void detach();
+    // audio thread: renders p_frames frames, silence when detached
+    void mix(AudioFrame *p_buffer, int32_t p_frames);
+
+    Ref<AudioStreamPlayback> _instantiate_playback() const override;
+    String _get_stream_name() const override;
+    double _get_length() const override { return 0.0; }
+    bool _is_monophonic() const override { return true; }
+};
+
+class AudioStreamPlaybackGDSynth : public AudioStreamPlayback {
+    GDCLASS(AudioStreamPlaybackGDSynth, AudioStreamPlayback);
+    friend class AudioStreamGDSynth;
+
+    Ref<AudioStreamGDSynth> stream;
+    bool active = false;
+    int64_t mixedFrames = 0;
+protected:
+    static void _bind_methods() {}
+public:
+    void _start(double p_from_pos) override;
+    void _stop() override;
+    bool _is_playing() const override { return active; }
+    int32_t _get_loop_count() const override { return 0; }
+    double _get_playback_position() const override;
+    void _seek(double p_position) override {}
+    // p_rate_scale (pitch_scale of the player) is ignored: the song plays at its own tempo
+    int32_t _mix(AudioFrame *p_buffer, float p_rate_scale, int32_t p_frames) override;
+};
+}
+
+#endif // AUDIO_STREAM_GDSYNTH_H
@@ -0,0 +1,56 @@
+/**************************************************************************/
+/*  debug_print.hpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef DEBUG_PRINT_H
+#define DEBUG_PRINT_H
+
+#include <sstream>
+#include <string>
+
+// Debug output for the synthesis core.
+// The core does not link against godot-cpp, so messages are formatted here and
+// handed to a sink. The GDExtension binding installs a sink that forwards to
+// UtilityFunctions::print(); headless builds fall back to stderr.
+namespace gdsynth {
+
+using PrintSink = void (*)(const char*);
+
+void setPrintSink(PrintSink sink);
+void printLine(const std::string &line);
+
+template <typename... Args>
+void print(const Args &...args) {
+    std::ostringstream os;
+    (os << ... << args);
+    printLine(os.str());
+}
+
+} // namespace gdsynth
+
+#endif // DEBUG_PRINT_H
@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*  denormals.hpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef DENORMALS_H
+#define DENORMALS_H
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <xmmintrin.h>
+#define GDSYNTH_DENORMALS_MXCSR
+#elif defined(__aarch64__)
+#define GDSYNTH_DENORMALS_FPCR
+#endif
+
+// Flushes subnormal floats to zero on the calling thread while in scope and
+// restores the previous mode on exit. Release slopes, decaying delay feedback
+// and control ramps run into subnormals, which take a slow microcode path on
+// x86. On x86 this sets FTZ and DAZ in MXCSR, on AArch64 FZ in FPCR.
+// WebAssembly has no such mode; there the audibility culling of Sequencer
+// retires the decaying voices and tails before they get that small.
+class ScopedFlushDenormals {
+public:
+    ScopedFlushDenormals(const ScopedFlushDenormals&) = delete;
+    ScopedFlushDenormals& operator=(const ScopedFlushDenormals&) = delete;
+#if defined(GDSYNTH_DENORMALS_MXCSR)
+    ScopedFlushDenormals() : saved(_mm_getcsr()) { _mm_setcsr(saved | ftzDaz); }
+    ~ScopedFlushDenormals() { _mm_setcsr(saved); }
+private:
+    static constexpr uint32_t ftzDaz = 0x8040; // FTZ (bit 15) | DAZ (bit 6)
+    uint32_t saved;
+#elif defined(GDSYNTH_DENORMALS_FPCR)
+    ScopedFlushDenormals() {
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(saved));
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(saved | flushToZero));
+    }
+    ~ScopedFlushDenormals() { __asm__ __volatile__("msr fpcr, %0" : : "r"(saved)); }
+private:
+    static constexpr uint64_t flushToZero = 1ull << 24; // FZ
+    uint64_t saved;
+#else
+    ScopedFlushDenormals() {}
+#endif
+};
+
+#endif // DENORMALS_H
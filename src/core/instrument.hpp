@@ -48,296 +48,296 @@ const std::array<Instrument, Sequencer::numinstruments> defaultInstruments = {
         //                                   |        |       |     |       |      |    |        |  baseWave1          | baseWave2           | baseWave2         | noiseColorType  |      |      |     |     |   delay2Ratio   |    |                  |     |     |    |  fmWave             |     |     |    |  amWave       
         //                                   |        |       |     |       |      |    |        |    |                |    |                |    |              |    |            |      |      |     |     |     |           |    |                  |     |     |    |   |                 |     |     |    |   |           
         /* Piano                       */ 
-        /*00    Acoustic Piano         */ { 1.00,   15.0,  110.0,  0.05, 120.0,   0.5, 0.60,    0.0, BW_SIN     ,  1200.0, BW_SINSAWx2,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*01    Bright Piano           */ { 1.00,   20.0,  110.0,  0.05, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_TRIANGLE,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*02    Electric Grand Piano   */ { 1.00,   20.0,  110.0,  0.05, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*03    Honky-tonk Piano       */ { 1.00,   20.0,  110.0,  0.05, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*04    Electric Piano         */ { 1.00,   20.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_TRIANGLE,  1200.0, BW_SQUARE  ,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*05    Electric Piano 2       */ { 1.00,   20.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_TRIANGLE,  1200.0, BW_TRIANGLE,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*06    Harpsichord            */ { 1.00,    5.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_SQUARE  ,  1200.0, BW_TRIANGLE,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*07    Clavi                  */ { 1.00,   20.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*00    Acoustic Piano         */ { 1.00,   15.0,  110.0,  0.05, 120.0,   0.5, 0.60,    0.0, BW_SIN     ,  1200.0, BW_SINSAWx2,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*01    Bright Piano           */ { 1.00,   20.0,  110.0,  0.05, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_TRIANGLE,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*02    Electric Grand Piano   */ { 1.00,   20.0,  110.0,  0.05, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*03    Honky-tonk Piano       */ { 1.00,   20.0,  110.0,  0.05, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*04    Electric Piano         */ { 1.00,   20.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_TRIANGLE,  1200.0, BW_SQUARE  ,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*05    Electric Piano 2       */ { 1.00,   20.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_TRIANGLE,  1200.0, BW_TRIANGLE,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*06    Harpsichord            */ { 1.00,    5.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_SQUARE  ,  1200.0, BW_TRIANGLE,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*07    Clavi                  */ { 1.00,   20.0,  110.0,  0.10, 120.0,   0.4, 0.75,    0.0, BW_SINSAWx2,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 147.0, 177.0,  0.20, 0.10, 0.05,      30.0, NDT_TRIANGULAR,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /* Chromatic Percussion        */ 
-        /*08    Celesta                */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*09    Glockenspiel           */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*0A    Music box              */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*0B    Vibraphone             */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*0C    Marimba                */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*0D    Xylophone              */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*0E    Tubular Bell           */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*0F    Dulcimer               */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*08    Celesta                */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*09    Glockenspiel           */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*0A    Music box              */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*0B    Vibraphone             */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*0C    Marimba                */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*0D    Xylophone              */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*0E    Tubular Bell           */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*0F    Dulcimer               */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     240.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Organ                      */ 
-        /*10    Drawbar Organ          */ { 1.00,   20.0,  150.0,  1.00,  20.0,   0.6, 0.6,     0.0, BW_SAWTOOTH,  1200.0, BW_SAWTOOTH,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*11    Percussive Organ       */ { 1.00,   20.0,  120.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,  2400.0, BW_SINSAWx2,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*12    Rock Organ             */ { 1.00,   20.0,  150.0,  1.00,  20.0,   0.6, 0.6,     0.0, BW_SAWTOOTH,  1200.0, BW_SAWTOOTH,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*13    Church organ           */ { 0.80,   20.0,  150.0,  1.00,  20.0,   0.6, 0.6,     0.0, BW_SINSAWx2,  1200.0, BW_SAWTOOTH,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*14    Reed organ             */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*15    Accordion              */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*16    Harmonica              */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*17    Tango Accordion        */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*10    Drawbar Organ          */ { 1.00,   20.0,  150.0,  1.00,  20.0,   0.6, 0.6,     0.0, BW_SAWTOOTH,  1200.0, BW_SAWTOOTH,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*11    Percussive Organ       */ { 1.00,   20.0,  120.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,  2400.0, BW_SINSAWx2,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*12    Rock Organ             */ { 1.00,   20.0,  150.0,  1.00,  20.0,   0.6, 0.6,     0.0, BW_SAWTOOTH,  1200.0, BW_SAWTOOTH,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*13    Church organ           */ { 0.80,   20.0,  150.0,  1.00,  20.0,   0.6, 0.6,     0.0, BW_SINSAWx2,  1200.0, BW_SAWTOOTH,  2400.0, BW_TRIANGLE,  0.01, NCT_PINK ,  99.0, 127.0, 177.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*14    Reed organ             */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*15    Accordion              */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*16    Harmonica              */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*17    Tango Accordion        */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Guitar                     */ 
-        /*18    Acoustic Guitar (nylon)*/ { 1.00,   20.0,  120.0,  0.05, 160.0,  0.33, 0.5,     0.0, BW_SQUARE  ,  1200.0, BW_SAWTOOTH,  2400.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  27.0, 167.0, 197.0,  0.15, 0.20, 0.05,     400.0, NDT_TRIANGULAR,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*19    Acoustic Guitar (steel)*/ { 1.00,   20.0,  150.0,  0.05, 160.0,  0.33, 0.5,     0.0, BW_SQUARE  ,  1200.0, BW_SAWTOOTH,  2400.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  27.0, 167.0, 197.0,  0.15, 0.20, 0.05,      40.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*1A    Electric Guitar (jazz) */ { 1.00,   20.0,  150.0,  0.10,  20.0,   0.8, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*1B    Electric Guitar (clean)*/ { 1.00,   20.0,  150.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*1C    Electric Guitar (muted)*/ { 1.00,   20.0,   30.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*1D    Overdriven Guitar      */ { 1.00,   20.0,   50.0,  0.70,  20.0,   0.5, 0.7,     0.0, BW_SQUARE  ,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*1E    Distortion Guitar      */ { 1.00,   20.0,   50.0,  0.70,  20.0,   0.5, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*1F    Guitar harmonics       */ { 1.00,   20.0,  110.0,  0.05, 120.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE, 117.0, 137.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*18    Acoustic Guitar (nylon)*/ { 1.00,   20.0,  120.0,  0.05, 160.0,  0.33, 0.5,     0.0, BW_SQUARE  ,  1200.0, BW_SAWTOOTH,  2400.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  27.0, 167.0, 197.0,  0.15, 0.20, 0.05,     400.0, NDT_TRIANGULAR,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*19    Acoustic Guitar (steel)*/ { 1.00,   20.0,  150.0,  0.05, 160.0,  0.33, 0.5,     0.0, BW_SQUARE  ,  1200.0, BW_SAWTOOTH,  2400.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  27.0, 167.0, 197.0,  0.15, 0.20, 0.05,      40.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*1A    Electric Guitar (jazz) */ { 1.00,   20.0,  150.0,  0.10,  20.0,   0.8, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*1B    Electric Guitar (clean)*/ { 1.00,   20.0,  150.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*1C    Electric Guitar (muted)*/ { 1.00,   20.0,   30.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*1D    Overdriven Guitar      */ { 1.00,   20.0,   50.0,  0.70,  20.0,   0.5, 0.7,     0.0, BW_SQUARE  ,  1200.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*1E    Distortion Guitar      */ { 1.00,   20.0,   50.0,  0.70,  20.0,   0.5, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*1F    Guitar harmonics       */ { 1.00,   20.0,  110.0,  0.05, 120.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE, 117.0, 137.0, 177.0,  0.20, 0.10, 0.05,       0.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Bass                       */ 
-        /*20    Acoustic Bass          */ { 0.50,   40.0,  120.0,  0.05,  50.0,   0.7, 0.7,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*21    Electric Bass (finger) */ { 0.50,   40.0,  120.0,  0.05,  50.0,   0.7, 0.7,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*22    Electric Bass (pick)   */ { 0.50,   20.0,  100.0,  0.10,  50.0,   0.7, 0.7,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*23    Fretless Bass          */ { 1.00,   60.0,  150.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*24    Slap Bass 1            */ { 1.00,   30.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*25    Slap Bass 2            */ { 1.00,   30.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*26    Synth Bass 1           */ { 1.00,   20.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*27    Synth Bass 2           */ { 1.00,   20.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*20    Acoustic Bass          */ { 0.50,   40.0,  120.0,  0.05,  50.0,   0.7, 0.7,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*21    Electric Bass (finger) */ { 0.50,   40.0,  120.0,  0.05,  50.0,   0.7, 0.7,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*22    Electric Bass (pick)   */ { 0.50,   20.0,  100.0,  0.10,  50.0,   0.7, 0.7,     0.0, BW_SIN     ,     0.0, BW_SAWTOOTH,  1200.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*23    Fretless Bass          */ { 1.00,   60.0,  150.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*24    Slap Bass 1            */ { 1.00,   30.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*25    Slap Bass 2            */ { 1.00,   30.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*26    Synth Bass 1           */ { 1.00,   20.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*27    Synth Bass 2           */ { 1.00,   20.0,  100.0,  0.10,  50.0,   0.9, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SAWTOOTH,     0.0, BW_SAWTOOTH,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Strings                    */ 
-        /*28    Violin                 */ { 1.00,   40.0,  500.0,  0.80,  20.0,   0.5, 0.6,     0.0, BW_SQUARE  ,  2400.0, BW_SAWTOOTH,  4800.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.1, 17.0 , 1.5 , 0, BW_SAWT_INV  },
-        /*29    Viola                  */ { 1.00,   60.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.2, 13.0 , 1.5 , 0, BW_SAWT_INV  },
-        /*2A    Cello                  */ { 1.00,   80.0,  500.0,  0.80,  60.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.2, 13.0 , 1.5 , 0, BW_SAWT_INV  },
-        /*2B    Double bass            */ { 1.00,  100.0,  500.0,  0.80, 100.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.3, 13.0 , 1.5 , 0, BW_SAWT_INV  },
-        /*2C    Tremolo Strings        */ { 1.00,   20.0,  500.0,  0.80,  20.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,  100.0, 4.00 , 1.0 , 1, BW_SQUARE    ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*2D    Pizzicato Strings      */ { 1.00,   20.0,   70.0,  0.10,  20.0,   0.8, 1.0,     0.0, BW_TRIANGLE,  1200.0, BW_SIN     ,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,       5.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*2E    Orchestral Harp        */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*2F    Timpani                */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*28    Violin                 */ { 1.00,   40.0,  500.0,  0.80,  20.0,   0.5, 0.6,     0.0, BW_SQUARE  ,  2400.0, BW_SAWTOOTH,  4800.0, BW_TRIANGLE,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.1, 17.0 , 1.5 , 0, BW_SAWT_INV  , 0 },
+        /*29    Viola                  */ { 1.00,   60.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.2, 13.0 , 1.5 , 0, BW_SAWT_INV  , 0 },
+        /*2A    Cello                  */ { 1.00,   80.0,  500.0,  0.80,  60.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.2, 13.0 , 1.5 , 0, BW_SAWT_INV  , 0 },
+        /*2B    Double bass            */ { 1.00,  100.0,  500.0,  0.80, 100.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,   20.0, 4.00 , 1.5 , 0, BW_SIN       ,    0.3, 13.0 , 1.5 , 0, BW_SAWT_INV  , 0 },
+        /*2C    Tremolo Strings        */ { 1.00,   20.0,  500.0,  0.80,  20.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,  0.01, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     100.0, NDT_TRIANGULAR,  100.0, 4.00 , 1.0 , 1, BW_SQUARE    ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*2D    Pizzicato Strings      */ { 1.00,   20.0,   70.0,  0.10,  20.0,   0.8, 1.0,     0.0, BW_TRIANGLE,  1200.0, BW_SIN     ,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,       5.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*2E    Orchestral Harp        */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*2F    Timpani                */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Ensemble                   */ 
-        /*30    String Ensemble 1      */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       },
-        /*31    String Ensemble 2      */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       },
-        /*32    Synth Strings 1        */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       },
-        /*33    Synth Strings 2        */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       },
-        /*34    Voice Aahs             */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,   20.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*35    Voice Oohs             */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,   20.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*36    Synth Voice            */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,   20.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*37    Orchestra Hit          */ { 1.00,    50.0,  70.0,  0.00, 600.0,   0.3, 0.5,     0.0, BW_SINSAWx2,  1800.0, BW_SQUARE  ,  3100.0, BW_TRIANGLE,   0.2, NCT_WHITE, 199.0, 247.0, 317.0,  0.05, 0.15, 0.20,     900.0, NDT_FLAT      ,  400.0,40.00 , 0.0 , 0, BW_SQUARE    ,    1.0,  1.0 , 1.5 , 0, BW_SAWT_INV  },
+        /*30    String Ensemble 1      */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       , 0 },
+        /*31    String Ensemble 2      */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       , 0 },
+        /*32    Synth Strings 1        */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       , 0 },
+        /*33    Synth Strings 2        */ { 0.80,   40.0,  500.0,  0.80,  40.0,   0.5, 0.6,     0.0, BW_SINSAWx2,  2400.0, BW_SAWTOOTH,  4800.0, BW_SAWTOOTH,   0.1, NCT_PINK , 117.0, 167.0, 197.0,  0.20, 0.10, 0.05,     200.0, NDT_TRIANGULAR,   20.0, 8.00 , 1.5 , 0, BW_SIN       ,    0.3, 12.0 , 1.5 , 0, BW_SIN       , 0 },
+        /*34    Voice Aahs             */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,   20.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*35    Voice Oohs             */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,   20.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*36    Synth Voice            */ { 1.00,   50.0,  500.0,  0.50,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      60.0, NDT_COS4ThPOW ,   20.0, 4.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*37    Orchestra Hit          */ { 1.00,    50.0,  70.0,  0.00, 600.0,   0.3, 0.5,     0.0, BW_SINSAWx2,  1800.0, BW_SQUARE  ,  3100.0, BW_TRIANGLE,   0.2, NCT_WHITE, 199.0, 247.0, 317.0,  0.05, 0.15, 0.20,     900.0, NDT_FLAT      ,  400.0,40.00 , 0.0 , 0, BW_SQUARE    ,    1.0,  1.0 , 1.5 , 0, BW_SAWT_INV  , 0 },
         /*  Brass                      */ 
-        /*38    Trumpet                */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*39    Trombone               */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*3A    Tuba                   */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*3B    Muted Trumpet          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*3C    French horn            */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*3D    Brass Section          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*3E    Synth Brass 1          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*3F    Synth Brass 2          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*38    Trumpet                */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*39    Trombone               */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*3A    Tuba                   */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*3B    Muted Trumpet          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*3C    French horn            */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*3D    Brass Section          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*3E    Synth Brass 1          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*3F    Synth Brass 2          */ { 0.35,  100.0,   50.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Reed                       */ 
-        /*40    Soprano Sax            */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*41    Alto Sax               */ { 0.35,   50.0,  500.0,  1.00,  50.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*42    Tenor Sax              */ { 0.35,   50.0,  500.0,  1.00,  50.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*43    Baritone Sax           */ { 0.35,  100.0,  500.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*44    Oboe                   */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*45    English Horn           */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*46    Bassoon                */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*47    Clarinet               */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*40    Soprano Sax            */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*41    Alto Sax               */ { 0.35,   50.0,  500.0,  1.00,  50.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*42    Tenor Sax              */ { 0.35,   50.0,  500.0,  1.00,  50.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*43    Baritone Sax           */ { 0.35,  100.0,  500.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*44    Oboe                   */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*45    English Horn           */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*46    Bassoon                */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*47    Clarinet               */ { 0.35,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      30.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Pipe                       */ 
-        /*48    Piccolo                */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SINSAWx2,  2400.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,      50.0, NDT_TRIANGULAR,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*49    Flute                  */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SINSAWx2,  2400.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,      50.0, NDT_TRIANGULAR,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*4A    Recorder               */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SQUARE  ,  2400.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,      50.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*4B    Pan Flute              */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SQUARE  ,  1200.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,     200.0, NDT_FLAT      ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*4C    Blown Bottle           */ { 1.00,   40.0,  500.0,  1.00, 120.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.2, NCT_PINK ,  97.0, 177.0, 197.0,  0.20, 0.10, 0.05,     600.0, NDT_FLAT      ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*4D    Shakuhachi             */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_PINK ,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*4E    Whistle                */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_PINK ,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*4F    Ocarina                */ { 1.00,  200.0,  100.0,  0.30, 200.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*48    Piccolo                */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SINSAWx2,  2400.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,      50.0, NDT_TRIANGULAR,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*49    Flute                  */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SINSAWx2,  2400.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,      50.0, NDT_TRIANGULAR,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*4A    Recorder               */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SQUARE  ,  2400.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,      50.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*4B    Pan Flute              */ { 1.00,   20.0,  500.0,  1.00,  20.0,   0.8, 1.0,     0.0, BW_SQUARE  ,  1200.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.1, NCT_PINK , 113.0, 147.0, 177.0,  0.20, 0.10, 0.05,     200.0, NDT_FLAT      ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*4C    Blown Bottle           */ { 1.00,   40.0,  500.0,  1.00, 120.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.2, NCT_PINK ,  97.0, 177.0, 197.0,  0.20, 0.10, 0.05,     600.0, NDT_FLAT      ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*4D    Shakuhachi             */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_PINK ,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*4E    Whistle                */ { 1.00,   20.0,  500.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_PINK ,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*4F    Ocarina                */ { 1.00,  200.0,  100.0,  0.30, 200.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Synth Lead                 */ 
-        /*50    Lead 1 (square)        */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*51    Lead 2 (sawtooth)      */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*52    Lead 3 (calliope)      */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*53    Lead 4 (chiff)         */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*54    Lead 5 (charang)       */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*55    Lead 6 (voice)         */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*56    Lead 7 (fifths)        */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*57    Lead 8 (bass + lead)   */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*50    Lead 1 (square)        */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*51    Lead 2 (sawtooth)      */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*52    Lead 3 (calliope)      */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*53    Lead 4 (chiff)         */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*54    Lead 5 (charang)       */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*55    Lead 6 (voice)         */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*56    Lead 7 (fifths)        */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*57    Lead 8 (bass + lead)   */ { 0.70,   20.0,   50.0,  1.00,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Synth Pad                  */ 
-        /*58    Pad 1 (Fantasia)       */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*59    Pad 2 (warm)           */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*5A    Pad 3 (polysynth)      */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*5B    Pad 4 (choir)          */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*5C    Pad 5 (bowed)          */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*5D    Pad 6 (metallic)       */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*5E    Pad 7 (halo)           */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*5F    Pad 8 (sweep)          */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*58    Pad 1 (Fantasia)       */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*59    Pad 2 (warm)           */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*5A    Pad 3 (polysynth)      */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*5B    Pad 4 (choir)          */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*5C    Pad 5 (bowed)          */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*5D    Pad 6 (metallic)       */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*5E    Pad 7 (halo)           */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*5F    Pad 8 (sweep)          */ { 0.70,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Synth Effects              */ 
-        /*60    FX 1 (rain)            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*61    FX 2 (soundtrack)      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*62    FX 3 (crystal)         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*63    FX 4 (atmosphere)      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*64    FX 5 (brightness)      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*65    FX 6 (goblins)         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*66    FX 7 (echoes)          */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*67    FX 8 (sci-fi)          */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*60    FX 1 (rain)            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*61    FX 2 (soundtrack)      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*62    FX 3 (crystal)         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*63    FX 4 (atmosphere)      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*64    FX 5 (brightness)      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*65    FX 6 (goblins)         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*66    FX 7 (echoes)          */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*67    FX 8 (sci-fi)          */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Ethnic                     */ 
-        /*68    Sitar                  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*69    Banjo                  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*6A    Shamisen               */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*6B    Koto                   */ { 1.00,   20.0,  120.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*6C    Kalimba                */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*6D    Bagpipe                */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*6E    Fiddle                 */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*6F    Shanai                 */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*68    Sitar                  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*69    Banjo                  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*6A    Shamisen               */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*6B    Koto                   */ { 1.00,   20.0,  120.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*6C    Kalimba                */ { 1.00,   20.0,   50.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*6D    Bagpipe                */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*6E    Fiddle                 */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*6F    Shanai                 */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*70    Tinkle Bell            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*71    Agogo                  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*72    Steel Drums            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*73    Woodblock              */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*74    Taiko Drum             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*75    Melodic Tom            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*76    Synth Drum             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*77    Reverse Cymbal         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*70    Tinkle Bell            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*71    Agogo                  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*72    Steel Drums            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*73    Woodblock              */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*74    Taiko Drum             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,      20.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*75    Melodic Tom            */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*76    Synth Drum             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*77    Reverse Cymbal         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Sound effects              */ 
-        /*78    Guitar Fret Noise      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*79    Breath Noise           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*7A    Seashore               */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*7B    Bird Tweet             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*7C    Telephone Ring         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*7D    Helicopter             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*7E    Applause               */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*7F    Gunshot                */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*78    Guitar Fret Noise      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*79    Breath Noise           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*7A    Seashore               */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*7B    Bird Tweet             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*7C    Telephone Ring         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*7D    Helicopter             */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*7E    Applause               */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*7F    Gunshot                */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SAWTOOTH,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
 
         /* --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------- */
 
         /*  Percussive                 */ 
-        /*80    note35 Bass Drum 2     */ { 1.00,    5.0,   90.0,  0.00, 120.0,  0.33, 0.5,  -150.0, BW_SIN     ,     0.0, BW_SIN     ,   150.0, BW_SIN     ,  0.10, NCT_PINK , 107.0, 127.0, 147.0,  0.20, 0.10, 0.05,     900.0, NDT_COS4ThPOW ,    1.0, 50.0 , 1.5 , 0, BW_SAWTOOTH  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*81    note36 Bass Drum 1     */ { 1.00,    5.0,   90.0,  0.00, 120.0,   0.6, 0.5,  -150.0, BW_SIN     ,     0.0, BW_SIN     ,   150.0, BW_SIN     ,  0.10, NCT_PINK , 107.0, 127.0, 147.0,  0.20, 0.10, 0.05,     900.0, NDT_COS4ThPOW ,    1.0, 50.0 , 1.5 , 0, BW_SAWTOOTH  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*82    note37 Side Stick      */ { 0.80,    1.0,   40.0,  0.00,  20.0,  0.55,0.60,     0.0, BW_SINSAWx2,   200.0, BW_SAWTOOTH,   400.0, BW_TRIANGLE,  0.05, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    3600.0, NDT_FLAT      ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*83    note38 Snare Drum 1    */ { 0.80,    5.0,   40.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,   700.0, BW_SQUARE  ,   0.1, NCT_WHITE,  47.0,  77.0,  97.0,  0.20, 0.15, 0.10,    2400.0, NDT_COS4ThPOW ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*84    note39 Hand Clap       */ { 0.80,    1.0,   30.0,  0.00,  20.0,   0.5, 0.5,     0.0, BW_TRIANGLE,   200.0, BW_SINSAWx2,   400.0, BW_SINSAWx2,  0.10, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    7200.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*85    note40 Snare Drum 2    */ { 0.80,    5.0,   40.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,   700.0, BW_SQUARE  ,   0.1, NCT_WHITE,  47.0,  77.0,  97.0,  0.20, 0.15, 0.10,    2400.0, NDT_COS4ThPOW ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*86    note41 Low Tom 2       */ { 1.00,    5.0,   50.0,  0.01, 100.0,   0.4, 0.5,     0.0, BW_SQUARE  ,  1200.0, BW_SAWTOOTH, -1200.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     800.0, NDT_FLAT      ,  120.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*87    note42 Closed Hi-hat   */ { 0.50,    3.0,   20.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SINSAWx2,   100.0, BW_SINSAWx2,   200.0, BW_SINSAWx2,   0.5, NCT_PINK ,  67.0,  87.0, 117.0,  0.20, 0.10, 0.05,    1200.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*80    note35 Bass Drum 2     */ { 1.00,    5.0,   90.0,  0.00, 120.0,  0.33, 0.5,  -150.0, BW_SIN     ,     0.0, BW_SIN     ,   150.0, BW_SIN     ,  0.10, NCT_PINK , 107.0, 127.0, 147.0,  0.20, 0.10, 0.05,     900.0, NDT_COS4ThPOW ,    1.0, 50.0 , 1.5 , 0, BW_SAWTOOTH  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*81    note36 Bass Drum 1     */ { 1.00,    5.0,   90.0,  0.00, 120.0,   0.6, 0.5,  -150.0, BW_SIN     ,     0.0, BW_SIN     ,   150.0, BW_SIN     ,  0.10, NCT_PINK , 107.0, 127.0, 147.0,  0.20, 0.10, 0.05,     900.0, NDT_COS4ThPOW ,    1.0, 50.0 , 1.5 , 0, BW_SAWTOOTH  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*82    note37 Side Stick      */ { 0.80,    1.0,   40.0,  0.00,  20.0,  0.55,0.60,     0.0, BW_SINSAWx2,   200.0, BW_SAWTOOTH,   400.0, BW_TRIANGLE,  0.05, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    3600.0, NDT_FLAT      ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*83    note38 Snare Drum 1    */ { 0.80,    5.0,   40.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,   700.0, BW_SQUARE  ,   0.1, NCT_WHITE,  47.0,  77.0,  97.0,  0.20, 0.15, 0.10,    2400.0, NDT_COS4ThPOW ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*84    note39 Hand Clap       */ { 0.80,    1.0,   30.0,  0.00,  20.0,   0.5, 0.5,     0.0, BW_TRIANGLE,   200.0, BW_SINSAWx2,   400.0, BW_SINSAWx2,  0.10, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    7200.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*85    note40 Snare Drum 2    */ { 0.80,    5.0,   40.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,   700.0, BW_SQUARE  ,   0.1, NCT_WHITE,  47.0,  77.0,  97.0,  0.20, 0.15, 0.10,    2400.0, NDT_COS4ThPOW ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*86    note41 Low Tom 2       */ { 1.00,    5.0,   50.0,  0.01, 100.0,   0.4, 0.5,     0.0, BW_SQUARE  ,  1200.0, BW_SAWTOOTH, -1200.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     800.0, NDT_FLAT      ,  120.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*87    note42 Closed Hi-hat   */ { 0.50,    3.0,   20.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SINSAWx2,   100.0, BW_SINSAWx2,   200.0, BW_SINSAWx2,   0.5, NCT_PINK ,  67.0,  87.0, 117.0,  0.20, 0.10, 0.05,    1200.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*88    note43 Low Tom 1       */ { 1.00,    5.0,   50.0,  0.01, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*89    note44 Pedal Hi-hat    */ { 0.50,    3.0,   60.0,  0.00, 120.0,   0.4, 0.5,     0.0, BW_SINSAWx2,    90.0, BW_SINSAWx2,   150.0, BW_SINSAWx2,   0.0, NCT_WHITE,  97.0, 147.0, 217.0,  0.20, 0.10, 0.05,    1200.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*8A    note45 Mid Tom 2       */ { 1.00,    5.0,   50.0,  0.00, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*8B    note46 Open Hi-hat     */ { 0.50,    3.0,   90.0,  0.05, 120.0,   0.4, 0.5,     0.0, BW_SINSAWx2,   100.0, BW_SINSAWx2,   200.0, BW_SINSAWx2,   0.5, NCT_PINK ,  97.0, 147.0, 217.0,  0.20, 0.10, 0.05,    1200.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*8C    note47 Mid Tom 1       */ { 1.00,    5.0,   50.0,  0.00, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*8D    note48 High Tom 2      */ { 1.00,    5.0,   50.0,  0.00, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*8E    note49 Crash Cymbal 1  */ { 0.50,    1.0,   50.0,  0.00, 120.0,   0.4, 0.5,  2300.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 137.0, 157.0, 177.0,  0.20, 0.15, 0.10,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*8F    note50 High Tom 1      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SQUARE  ,   190.0, BW_SINSAWx2,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*88    note43 Low Tom 1       */ { 1.00,    5.0,   50.0,  0.01, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*89    note44 Pedal Hi-hat    */ { 0.50,    3.0,   60.0,  0.00, 120.0,   0.4, 0.5,     0.0, BW_SINSAWx2,    90.0, BW_SINSAWx2,   150.0, BW_SINSAWx2,   0.0, NCT_WHITE,  97.0, 147.0, 217.0,  0.20, 0.10, 0.05,    1200.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*8A    note45 Mid Tom 2       */ { 1.00,    5.0,   50.0,  0.00, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*8B    note46 Open Hi-hat     */ { 0.50,    3.0,   90.0,  0.05, 120.0,   0.4, 0.5,     0.0, BW_SINSAWx2,   100.0, BW_SINSAWx2,   200.0, BW_SINSAWx2,   0.5, NCT_PINK ,  97.0, 147.0, 217.0,  0.20, 0.10, 0.05,    1200.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*8C    note47 Mid Tom 1       */ { 1.00,    5.0,   50.0,  0.00, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*8D    note48 High Tom 2      */ { 1.00,    5.0,   50.0,  0.00, 100.0,   0.4, 0.5,     0.0, BW_SAWTOOTH,   190.0, BW_SAWTOOTH,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*8E    note49 Crash Cymbal 1  */ { 0.50,    1.0,   50.0,  0.00, 120.0,   0.4, 0.5,  2300.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 137.0, 157.0, 177.0,  0.20, 0.15, 0.10,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*8F    note50 High Tom 1      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SQUARE  ,   190.0, BW_SINSAWx2,    90.0, BW_SAWTOOTH,   0.2, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,    2400.0, NDT_FLAT      ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*90    note51 Ride Cymbal 1   */ { 0.50,    1.0,   40.0,  0.00,  20.0,   0.4, 0.5,  3500.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 119.0, 167.0, 197.0,  0.20, 0.10, 0.05,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*91    note52 Chinese Cymbal  */ { 0.50,    1.0,   50.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6000.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 137.0, 157.0, 177.0,  0.20, 0.15, 0.10,    7200.0, NDT_FLAT      ,    1.0,200.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*92    note53 Ride Bell       */ { 1.00,    5.0,   90.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*93    note54 Tambourine      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*94    note55 Splash Cymbal   */ { 1.00,    3.0,   40.0,  0.00, 120.0,   0.4, 0.5,   110.0, BW_SIN     ,  2400.0, BW_SIN     ,  3700.0, BW_SIN     ,   0.3, NCT_PINK , 111.0, 167.0, 180.0,  0.20, 0.10, 0.05,    8400.0, NDT_COS4ThPOW ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*95    note56 Cowbell         */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*96    note57 Crash Cymbal 2  */ { 0.50,    1.0,   50.0,  0.00, 120.0,   0.4, 0.5,  2300.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 137.0, 157.0, 177.0,  0.20, 0.15, 0.10,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*97    note58 Vibra Slap      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*90    note51 Ride Cymbal 1   */ { 0.50,    1.0,   40.0,  0.00,  20.0,   0.4, 0.5,  3500.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 119.0, 167.0, 197.0,  0.20, 0.10, 0.05,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*91    note52 Chinese Cymbal  */ { 0.50,    1.0,   50.0,  0.00,  20.0,   0.4, 0.5,     0.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6000.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 137.0, 157.0, 177.0,  0.20, 0.15, 0.10,    7200.0, NDT_FLAT      ,    1.0,200.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*92    note53 Ride Bell       */ { 1.00,    5.0,   90.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*93    note54 Tambourine      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*94    note55 Splash Cymbal   */ { 1.00,    3.0,   40.0,  0.00, 120.0,   0.4, 0.5,   110.0, BW_SIN     ,  2400.0, BW_SIN     ,  3700.0, BW_SIN     ,   0.3, NCT_PINK , 111.0, 167.0, 180.0,  0.20, 0.10, 0.05,    8400.0, NDT_COS4ThPOW ,   20.0, 20.0 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*95    note56 Cowbell         */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*96    note57 Crash Cymbal 2  */ { 0.50,    1.0,   50.0,  0.00, 120.0,   0.4, 0.5,  2300.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 137.0, 157.0, 177.0,  0.20, 0.15, 0.10,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*97    note58 Vibra Slap      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*98    note59 Ride Cymbal 2   */ { 0.50,    1.0,   40.0,  0.00,  20.0,   0.4, 0.5,  3500.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 119.0, 167.0, 197.0,  0.20, 0.10, 0.05,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*99    note60 High Bongo      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*9A    note61 Low Bongo       */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*9B    note62 Mute High Conga */ { 1.00,    5.0,   30.0,  0.00,  20.0,   0.5, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*9C    note63 Open High Conga */ { 1.00,    5.0,   80.0,  0.00,  20.0,   0.5, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*9D    note64 Low Conga       */ { 1.00,    5.0,   50.0,  0.00,  20.0,   0.5, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*9E    note65 High Timbale    */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*9F    note66 Low Timbale     */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*98    note59 Ride Cymbal 2   */ { 0.50,    1.0,   40.0,  0.00,  20.0,   0.4, 0.5,  3500.0, BW_SINSAWx2,  4800.0, BW_SAWTOOTH,  6100.0, BW_SAWTOOTH,   0.3, NCT_WHITE, 119.0, 167.0, 197.0,  0.20, 0.10, 0.05,    8400.0, NDT_FLAT      ,    0.0,  0.0 , 1.5 , 0, BW_SAWT_INV  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*99    note60 High Bongo      */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*9A    note61 Low Bongo       */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*9B    note62 Mute High Conga */ { 1.00,    5.0,   30.0,  0.00,  20.0,   0.5, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*9C    note63 Open High Conga */ { 1.00,    5.0,   80.0,  0.00,  20.0,   0.5, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,   20.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*9D    note64 Low Conga       */ { 1.00,    5.0,   50.0,  0.00,  20.0,   0.5, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*9E    note65 High Timbale    */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*9F    note66 Low Timbale     */ { 1.00,    5.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*A0    note67 High Agogo      */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A1    note68 Low Agogo       */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A2    note69 Cabasa          */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A3    note70 Maracas         */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A4    note71 Short Whistle   */ { 1.00,   50.0,  100.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A5    note72 Long Whistle    */ { 1.00,   90.0,  100.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A6    note73 Short Guiro     */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A7    note74 Long Guiro      */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*A0    note67 High Agogo      */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A1    note68 Low Agogo       */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A2    note69 Cabasa          */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A3    note70 Maracas         */ { 1.00,   20.0,   50.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A4    note71 Short Whistle   */ { 1.00,   50.0,  100.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A5    note72 Long Whistle    */ { 1.00,   90.0,  100.0,  1.00, 100.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A6    note73 Short Guiro     */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A7    note74 Long Guiro      */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*A8    note75 Claves          */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*A9    note76 High Wood Block */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*AA    note77 Low Wood Block  */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*AB    note78 Mute Cuica      */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*AC    note79 Open Cuica      */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*AD    note80 Mute Triangle   */ { 1.00,    5.0,   80.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,     600.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*AE    note81 Open Triangle   */ { 1.00,    5.0,  200.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     600.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*AF                           */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*A8    note75 Claves          */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*A9    note76 High Wood Block */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*AA    note77 Low Wood Block  */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*AB    note78 Mute Cuica      */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*AC    note79 Open Cuica      */ { 1.00,    5.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_TRIANGLE,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,    1200.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*AD    note80 Mute Triangle   */ { 1.00,    5.0,   80.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,     600.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*AE    note81 Open Triangle   */ { 1.00,    5.0,  200.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SIN     ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,  19.0,  37.0,  47.0,  0.20, 0.10, 0.05,     600.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*AF                           */ { 1.00,   20.0,  100.0,  0.00,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*B0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*B0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*B8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*B9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*BA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*BB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*BC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*BD                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*BE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*BF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*B8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*B9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*BA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*BB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*BC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*BD                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*BE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*BF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*C0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*C0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*C8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*C9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*CA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*CB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*CC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*CD                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*CE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*CF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*C8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*C9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*CA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*CB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*CC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*CD                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*CE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*CF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*D0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*D0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*D8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*D9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*DA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*DB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*DC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*DD                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*DE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*DF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*D8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*D9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*DA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*DB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*DC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*DD                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*DE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*DF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*E0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*E0                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E1                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E2                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E3                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E4                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E5                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E6                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E7                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*E8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*E9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*EA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*EB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*EC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*ED                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*EE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*EF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*E8                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*E9                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*EA                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*EB                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*EC                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*ED                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*EE                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*EF                           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*F0    prog70 Tinkle Bell     */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F1    prog71 Agogo           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F2    prog72 Steel Drums     */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F3    prog73 Woodblock       */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F4    prog74 Taiko Drum      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F5    prog75 Melodic Tom     */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F6    prog76 Synth Drum      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F7    prog77 Reverse Cymbal  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
+        /*F0    prog70 Tinkle Bell     */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F1    prog71 Agogo           */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F2    prog72 Steel Drums     */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F3    prog73 Woodblock       */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F4    prog74 Taiko Drum      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F5    prog75 Melodic Tom     */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F6    prog76 Synth Drum      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F7    prog77 Reverse Cymbal  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
         /*  Percussive                 */ 
-        /*F8    prog78 Gu. Fret Noise  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*F9    prog79 Breath Noise    */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*FA    prog7A Seashore        */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*FB    prog7B Bird Tweet      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*FC    prog7C Telephone Ring  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*FD    prog7D Helicopter      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*FE    prog7E Applause        */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  },
-        /*FF    prog7F Gunshot         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  } 
+        /*F8    prog78 Gu. Fret Noise  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*F9    prog79 Breath Noise    */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*FA    prog7A Seashore        */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*FB    prog7B Bird Tweet      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*FC    prog7C Telephone Ring  */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*FD    prog7D Helicopter      */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*FE    prog7E Applause        */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 },
+        /*FF    prog7F Gunshot         */ { 1.00,   20.0,  500.0,  0.10,  20.0,   1.0, 1.0,     0.0, BW_SQUARE  ,     0.0, BW_SINSAWx2,     0.0, BW_SINSAWx2,   0.0, NCT_WHITE,   0.0,   0.0,   0.0,  0.00, 0.00, 0.00,       0.0, NDT_COS4ThPOW ,    0.0, 0.00 , 1.5 , 0, BW_TRIANGLE  ,    0.0,  0.0 , 1.5 , 0, BW_TRIANGLE  , 0 } 
     }
 };
 
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*  lut_math.hpp                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef LUT_MATH_H
+#define LUT_MATH_H
+
+#include <cstdint>
+
+// constexpr replacements for the libm functions SharedLUT's rate independent
+// tables are built from, so those tables are computed by the compiler and end
+// up as read-only data. Double precision; the tables round the results to
+// float, within one float ulp of the libm versions.
+//
+// Iteration counts are kept low so a whole table stays inside the default
+// constexpr evaluation limits of GCC and Clang (emscripten).
+
+namespace gdsynth {
+namespace lutmath {
+
+constexpr double pi = 3.14159265358979323846;
+constexpr double ln2 = 0.69314718055994530942;
+
+// 2^n for integer n
+constexpr double pow2i(int32_t n) {
+    double base = (n < 0) ? 0.5 : 2.0;
+    uint32_t e = (uint32_t)((n < 0) ? -n : n);
+    double r = 1.0;
+    while (e != 0) {
+        if (e & 1u) r *= base;
+        base *= base;
+        e >>= 1;
+    }
+    return r;
+}
+
+constexpr double sin(double x) {
+    // reduce to [-pi, pi], then fold into [-pi/2, pi/2]
+    const int64_t k = (int64_t)(x / (2.0 * pi) + ((x < 0.0) ? -0.5 : 0.5));
+    x -= (double)k * (2.0 * pi);
+    if (x > pi * 0.5) x = pi - x;
+    else if (x < -pi * 0.5) x = -pi - x;
+    const double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int32_t n = 1; n < 12; n++) {
+        term *= -x2 / (double)((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cos(double x) {
+    return sin(x + pi * 0.5);
+}
+
+constexpr double exp(double x) {
+    // x = n*ln2 + r, |r| <= ln2/2
+    const int32_t n = (int32_t)(x / ln2 + ((x < 0.0) ? -0.5 : 0.5));
+    const double r = x - (double)n * ln2;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int32_t k = 1; k < 16; k++) {
+        term *= r / (double)k;
+        sum += term;
+    }
+    return sum * pow2i(n);
+}
+
+// x > 0
+constexpr double log(double x) {
+    // x = m*2^e, m in [sqrt(1/2), sqrt(2)), log(m) = 2*atanh((m-1)/(m+1))
+    int32_t e = 0;
+    while (x >= 2.0) { x *= 0.5; e++; }
+    while (x < 1.0) { x *= 2.0; e--; }
+    if (x > 1.41421356237309504880) { x *= 0.5; e++; }
+    const double z = (x - 1.0) / (x + 1.0);
+    const double z2 = z * z;
+    double term = z;
+    double sum = 0.0;
+    for (int32_t k = 0; k < 12; k++) {
+        sum += term / (double)(2 * k + 1);
+        term *= z2;
+    }
+    return 2.0 * sum + (double)e * ln2;
+}
+
+// x > 0
+constexpr double pow(double x, double y) {
+    return exp(y * log(x));
+}
+
+constexpr double tanh(double x) {
+    if (x > 20.0) return 1.0;
+    if (x < -20.0) return -1.0;
+    const double e = exp(2.0 * x);
+    return (e - 1.0) / (e + 1.0);
+}
+
+} // namespace lutmath
+} // namespace gdsynth
+
+#endif // LUT_MATH_H
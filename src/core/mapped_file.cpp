@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  mapped_file.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "mapped_file.hpp"
+
+#include <cstdio>
+#include <string>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_MMAP
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+
+bool MappedFile::open(const char *path) {
+    close();
+    if (path == nullptr) return false;
+
+#if defined(_WIN32)
+    int32_t wlen = MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+    if (wlen > 0) {
+        std::wstring wpath((size_t)wlen, L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, path, -1, &wpath[0], wlen);
+        HANDLE file = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file != INVALID_HANDLE_VALUE) {
+            LARGE_INTEGER fileSize;
+            if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+                HANDLE handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (handle != nullptr) {
+                    void *address = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+                    if (address != nullptr) {
+                        mapping = handle;
+                        view = (const uint8_t *)address;
+                        length = (size_t)fileSize.QuadPart;
+                        mapped = true;
+                    } else {
+                        CloseHandle(handle);
+                    }
+                }
+            }
+            CloseHandle(file); // the mapping keeps the file open
+            if (mapped) return true;
+        }
+    }
+#elif defined(MAPPED_FILE_MMAP)
+    int fd = ::open(path, O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void *address = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                madvise(address, (size_t)st.st_size, MADV_SEQUENTIAL);
+                view = (const uint8_t *)address;
+                length = (size_t)st.st_size;
+                mapped = true;
+            }
+        }
+        ::close(fd); // the mapping keeps the file open
+        if (mapped) return true;
+    }
+#endif
+    return readAll(path);
+}
+
+
+bool MappedFile::readAll(const char *path) {
+    FILE *fp = std::fopen(path, "rb");
+    if (fp == nullptr) return false;
+    bool ok = std::fseek(fp, 0, SEEK_END) == 0;
+    long fileSize = ok ? std::ftell(fp) : -1;
+    ok = ok && fileSize >= 0 && std::fseek(fp, 0, SEEK_SET) == 0;
+    if (ok) {
+        buffer.resize((size_t)fileSize);
+        ok = std::fread(buffer.data(), 1, buffer.size(), fp) == buffer.size();
+    }
+    std::fclose(fp);
+    if (!ok) {
+        buffer.clear();
+        return false;
+    }
+    view = buffer.data();
+    length = buffer.size();
+    return true;
+}
+
+
+void MappedFile::close(void) {
+    if (mapped) {
+#if defined(_WIN32)
+        UnmapViewOfFile(view);
+        CloseHandle((HANDLE)mapping);
+        mapping = nullptr;
+#elif defined(MAPPED_FILE_MMAP)
+        munmap((void *)view, length);
+#endif
+    }
+    buffer.clear();
+    buffer.shrink_to_fit();
+    view = nullptr;
+    length = 0;
+    mapped = false;
+}
@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  mpsc_queue.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded lock-free queue for any number of producer threads and one
+// consumer thread. Every cell carries a sequence number (after D. Vyukov's
+// bounded queue): a producer claims a position with one compare-exchange on
+// the write counter, fills the cell and publishes it through the cell's
+// sequence; the consumer takes cells in position order. The capacity is
+// rounded up to a power of two. A full queue refuses the push instead of
+// waiting, and no side ever takes a lock.
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() = default;
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    // Not thread-safe: call while no side is running.
+    void reset(size_t minCapacity) {
+        size_t size = 1;
+        while (size < minCapacity) size <<= 1;
+        cells = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        capacity = size;
+        mask = size - 1;
+        writePos.store(0, std::memory_order_relaxed);
+        readPos = 0;
+    }
+
+    size_t getCapacity() const { return capacity; }
+
+    // producer side, any thread: false when the queue is full
+    bool push(const T &value) {
+        uint64_t pos = writePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells[pos & mask];
+            const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const int64_t diff = (int64_t)(sequence - pos);
+            if (diff == 0) {
+                if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // the consumer has not freed this cell yet
+            } else {
+                pos = writePos.load(std::memory_order_relaxed); // another producer took it
+            }
+        }
+    }
+
+    // consumer side: false when empty (or the oldest push is still being written)
+    bool pop(T &value) {
+        Cell &cell = cells[readPos & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != readPos + 1) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(readPos + capacity, std::memory_order_release);
+        readPos++;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<uint64_t> sequence{0};
+        T value{};
+    };
+    std::unique_ptr<Cell[]> cells;
+    size_t capacity = 0;
+    size_t mask = 0;
+    // separate cache lines so the producers do not invalidate the consumer
+    alignas(64) std::atomic<uint64_t> writePos{0};
+    alignas(64) uint64_t readPos = 0;
+};
+
+#endif // MPSC_QUEUE_H
@@ -0,0 +1,68 @@
+/**************************************************************************/
+/*  pitch_mod.hpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PITCH_MOD_H
+#define PITCH_MOD_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Pitch modulation: cent offset -> frequency ratio for the per-sample FM and
+// frequency noise path.
+//
+// 2^(cent/1200) is split into an integer octave, applied through the float
+// exponent bits, and a fraction f in [0, 1) evaluated with a degree 5
+// polynomial fitted at the Chebyshev nodes of [0, 1). The polynomial's relative
+// error is below 1.1e-7 (about 0.0002 cent); with float rounding the result is
+// within 3e-7 of powf(). There are no branches or table lookups, so block loops
+// over centToRatio() vectorize.
+//
+// Offsets are limited to +-3600 cent, the range of SharedLUT's pow2_x_1200LUT.
+
+static constexpr float pitchModMaxCent = 3600.0f;
+
+inline float centToRatio(float cent) {
+    const float x = std::clamp(cent, -pitchModMaxCent, pitchModMaxCent) * (1.0f / 1200.0f);
+    const int32_t octave = (int32_t)(x + 4.0f) - 4; // x + 4 > 0, so truncation is floor
+    const float f = x - (float)octave;
+    const float p = 0.999999898f + f*(0.69315449f + f*(0.240141818f + f*(0.0558603371f + f*(0.00894959042f + f*0.00189375406f))));
+    const int32_t bits = (octave + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// ratio[i] = centToRatio(cent[i])
+inline void centToRatioBlock(const float* cent, float* ratio, int32_t numSamples) {
+    for (int32_t i = 0; i < numSamples; i++) {
+        ratio[i] = centToRatio(cent[i]);
+    }
+}
+
+#endif // PITCH_MOD_H
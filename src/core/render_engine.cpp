@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  render_engine.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "render_engine.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+struct RenderEngine::Instance {
+    Sequencer *sequencer = nullptr;
+    std::mutex *sequencerMutex = nullptr;
+    std::vector<float> buffer;      // rendered samples not pulled yet, [readPos, writePos)
+    int32_t readPos = 0;
+    int32_t writePos = 0;
+    int32_t need = 0;               // samples to render in the current batch
+};
+
+RenderEngine &RenderEngine::getInstance() {
+    static RenderEngine engine;
+    return engine;
+}
+
+RenderEngine::RenderEngine() {
+    pool.setThreads((int32_t)std::thread::hardware_concurrency());
+}
+
+RenderEngine::~RenderEngine() = default;
+
+
+RenderEngine::Instance *RenderEngine::attach(Sequencer &sequencer, std::mutex &sequencerMutex, int32_t maxFrames) {
+    auto instance = std::make_unique<Instance>();
+    instance->sequencer = &sequencer;
+    instance->sequencerMutex = &sequencerMutex;
+    instance->buffer.assign((size_t)std::max(maxFrames, 1), 0.0f);
+    std::lock_guard<std::mutex> lock(mutex);
+    instances.push_back(std::move(instance));
+    batch.reserve(instances.size());
+    return instances.back().get();
+}
+
+void RenderEngine::detach(Instance *instance) {
+    if (instance == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(instances.begin(), instances.end(),
+                           [instance](const std::unique_ptr<Instance> &entry) { return entry.get() == instance; });
+    if (it != instances.end()) {
+        instances.erase(it);
+    }
+}
+
+
+void RenderEngine::pull(Instance *instance, float *out, int32_t frames) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const int32_t capacity = (int32_t)instance->buffer.size();
+    for (int32_t done = 0; done < frames;) {
+        if (instance->readPos == instance->writePos) {
+            renderPeriod(std::min(frames - done, capacity));
+        }
+        const int32_t count = std::min(frames - done, instance->writePos - instance->readPos);
+        std::memcpy(out + done, instance->buffer.data() + instance->readPos, sizeof(float) * (size_t)count);
+        instance->readPos += count;
+        done += count;
+    }
+}
+
+// Tops every instance up to 'frames' buffered samples (or its capacity). An
+// instance that is not pulled, e.g. a stopped player, keeps its samples and
+// is not rendered further until it is pulled again.
+// The caller holds mutex.
+void RenderEngine::renderPeriod(int32_t frames) {
+    batch.clear();
+    for (const std::unique_ptr<Instance> &instance : instances) {
+        const int32_t target = std::min(frames, (int32_t)instance->buffer.size());
+        instance->need = target - (instance->writePos - instance->readPos);
+        if (instance->need > 0) {
+            batch.push_back(instance.get());
+            renderedFrames += instance->need;
+        }
+    }
+    auto job = [this](int32_t index, int32_t) {
+        Instance &instance = *batch[(size_t)index];
+        // move the unread samples to the front, the buffer holds one batch
+        const int32_t buffered = instance.writePos - instance.readPos;
+        if (instance.readPos > 0) {
+            std::memmove(instance.buffer.data(), instance.buffer.data() + instance.readPos, sizeof(float) * (size_t)buffered);
+            instance.readPos = 0;
+            instance.writePos = buffered;
+        }
+        // the audio thread does not wait for a seek or song swap on another
+        // thread: the instance gets a period of silence instead
+        std::unique_lock<std::mutex> lock(*instance.sequencerMutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            instance.sequencer->feed(instance.buffer.data() + instance.writePos, instance.need);
+        } else {
+            std::memset(instance.buffer.data() + instance.writePos, 0, sizeof(float) * (size_t)instance.need);
+            silentFrames.fetch_add(instance.need, std::memory_order_relaxed);
+        }
+        instance.writePos += instance.need;
+    };
+    pool.run((int32_t)batch.size(), job);
+    batches++;
+}
+
+
+void RenderEngine::setThreads(int32_t count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pool.setThreads(count);
+}
+
+int32_t RenderEngine::getThreads() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pool.getThreads();
+}
+
+EngineStats RenderEngine::getStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    EngineStats stats;
+    stats.instances = (int32_t)instances.size();
+    stats.threads = pool.getThreads();
+    stats.batches = batches;
+    stats.renderedFrames = renderedFrames;
+    stats.silentFrames = silentFrames.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*  render_engine.hpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef RENDER_ENGINE_H
+#define RENDER_ENGINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "sequencer.hpp"
+#include "worker_pool.hpp"
+
+// Process-wide render engine for several Sequencers.
+//
+// A game may run many GDSynthesizer nodes at once (music, stingers, radios).
+// Each registers its Sequencer with attach(). The first instance that pulls
+// the samples of an audio period renders that period for every registered
+// instance in one batch, one job per instance on the engine's worker pool;
+// the other instances find their samples buffered when they pull. Each
+// instance keeps its own Sequencer, so instruments, control params and voice
+// pool stay per instance (its renderThreads still split its own voices), and
+// it renders the same samples as it would alone. The LUTs are process-wide
+// already (SharedLUT).
+//
+// A job holds the instance's sequencer mutex for its feed(), so other threads
+// keep calling into an attached Sequencer under that mutex. The job only
+// tries the lock: when another thread holds it, the instance gets a period of
+// silence rather than stalling the audio thread, so keep the work done under
+// it short (decode a song outside it, see Sequencer::smfAdopt()). Lock order:
+// engine before any sequencer mutex; do not call attach(), detach() or
+// pull() while holding a sequencer mutex.
+
+struct EngineStats {
+    int32_t instances = 0;
+    int32_t threads = 0;
+    int64_t batches = 0;            // render passes over the instances
+    int64_t renderedFrames = 0;     // samples rendered, all instances
+    int64_t silentFrames = 0;       // of those, silence while the sequencer was locked
+};
+
+class RenderEngine {
+public:
+    struct Instance;
+
+    static RenderEngine &getInstance();
+    RenderEngine(const RenderEngine &) = delete;
+    RenderEngine &operator=(const RenderEngine &) = delete;
+
+    // Registers a Sequencer after its initParam(); pulls are at most maxFrames
+    // long per batch (longer ones are split). The returned handle stays valid
+    // until detach(). Nothing renders the Sequencer after detach() returns.
+    Instance *attach(Sequencer &sequencer, std::mutex &sequencerMutex, int32_t maxFrames);
+    void detach(Instance *instance);
+
+    // Audio thread: fills 'frames' samples of the instance, rendering the
+    // next period of every instance when its buffer is empty.
+    void pull(Instance *instance, float *out, int32_t frames);
+
+    // Threads of the batch, the caller included (1 .. WorkerPool::maxThreads).
+    void setThreads(int32_t count);
+    int32_t getThreads();
+    EngineStats getStats();
+
+private:
+    RenderEngine();
+    ~RenderEngine();
+    void renderPeriod(int32_t frames);
+
+    std::mutex mutex;               // everything below
+    WorkerPool pool;
+    std::vector<std::unique_ptr<Instance>> instances;
+    std::vector<Instance *> batch;  // instances rendered by one renderPeriod()
+    int64_t batches = 0;
+    int64_t renderedFrames = 0;
+    std::atomic<int64_t> silentFrames{0};   // written by the jobs
+};
+
+#endif // RENDER_ENGINE_H
@@ -0,0 +1,172 @@
+/**************************************************************************/
+/*  render_thread.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "render_thread.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+RenderThread::RenderThread(Sequencer &sequencer)
+    : sequencer(sequencer) {}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+
+bool RenderThread::start(int32_t depthMs) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    (void)depthMs;
+    return false;
+#else
+    stop();
+    const int32_t bufferSamples = sequencer.getBufferSamples();
+    if (bufferSamples <= 0) {
+        return false;
+    }
+    depthMs = std::clamp(depthMs, minDepthMs, maxDepthMs);
+    const int32_t depthFrames = std::max((int32_t)((float)depthMs * sequencer.getSamplingRate() / 1000.0f), bufferSamples * 2);
+    ring.reset((size_t)depthFrames);
+    events.reset(eventQueueSize);
+    scratch.assign((size_t)bufferSamples, 0.0f);
+    producedFrames = consumedFrames = 0;
+    primed = false;
+    renderedBuffers = underruns = underrunFrames = droppedEvents = 0;
+    priorityRaised = false;
+    this->depthMs = depthMs;
+    this->depthFrames = depthFrames;
+
+    // events are queued here and handed to the host's callback by drain()
+    hostEmit = sequencer.emitSignal;
+    sequencer.emitSignal = [this](const EmittedEvent &ev) {
+        TimedEvent timed;
+        timed.frame = producedFrames;
+        timed.event = ev;
+        if (!events.push(timed)) droppedEvents.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    stopRequest = false;
+    running = true;
+    worker = std::thread(&RenderThread::run, this);
+    return true;
+#endif
+}
+
+
+void RenderThread::stop() {
+    if (!worker.joinable()) {
+        return;
+    }
+    stopRequest = true;
+    worker.join();
+    running = false;
+    sequencer.emitSignal = hostEmit;
+    hostEmit = nullptr;
+}
+
+
+void RenderThread::run() {
+    priorityRaised = raisePriority();
+    const int32_t bufferSamples = (int32_t)scratch.size();
+    // poll a few times per buffer while the ring is full
+    const auto idle = std::chrono::microseconds((int64_t)(250000.0f * (float)bufferSamples / sequencer.getSamplingRate()));
+    while (!stopRequest.load(std::memory_order_acquire)) {
+        const int32_t buffered = (int32_t)(ring.getCapacity() - ring.writeAvailable());
+        if (buffered + bufferSamples > depthFrames) {
+            std::this_thread::sleep_for(idle);
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(sequencerMutex);
+            sequencer.feed(scratch.data());
+        }
+        ring.write(scratch.data(), (size_t)bufferSamples);
+        producedFrames += (uint64_t)bufferSamples;
+        renderedBuffers.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+
+void RenderThread::drain(float *out, int32_t frames) {
+    const int32_t got = (int32_t)ring.read(out, (size_t)frames);
+    if (got < frames) {
+        std::fill(out + got, out + frames, 0.0f);
+        if (primed) {
+            underruns.fetch_add(1, std::memory_order_relaxed);
+            underrunFrames.fetch_add(frames - got, std::memory_order_relaxed);
+        }
+    } else {
+        primed = true;
+    }
+    consumedFrames += (uint64_t)got;
+
+    for (const TimedEvent *timed = events.peek(); timed != nullptr && timed->frame <= consumedFrames; timed = events.peek()) {
+        if (hostEmit) hostEmit(timed->event);
+        events.pop();
+    }
+}
+
+
+RenderStats RenderThread::getStats() const {
+    RenderStats stats;
+    stats.renderedBuffers = renderedBuffers.load(std::memory_order_relaxed);
+    stats.underruns = underruns.load(std::memory_order_relaxed);
+    stats.underrunFrames = underrunFrames.load(std::memory_order_relaxed);
+    stats.droppedEvents = droppedEvents.load(std::memory_order_relaxed);
+    stats.depthFrames = depthFrames;
+    stats.bufferedFrames = (int32_t)ring.readAvailable();
+    stats.priorityRaised = priorityRaised.load(std::memory_order_relaxed);
+    return stats;
+}
+
+
+// Best effort: needs rights the process may not have (e.g. RLIMIT_RTPRIO on Linux).
+bool RenderThread::raisePriority() {
+#if defined(_WIN32)
+    return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+#elif defined(__linux__) || defined(__APPLE__)
+    sched_param param{};
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+#else
+    return false;
+#endif
+}
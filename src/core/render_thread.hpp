@@ -0,0 +1,126 @@
+/**************************************************************************/
+/*  render_thread.hpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sequencer.hpp"
+#include "spsc_ring.hpp"
+
+// Optional render thread.
+//
+// Without it the host calls Sequencer::feed() from its own loop (in Godot the
+// audio thread, through AudioStreamGDSynth), so a slow buffer has to fit in the
+// mix deadline. RenderThread runs feed() on a dedicated thread with raised priority
+// and writes the samples into a lock-free single producer / single consumer
+// ring; the host only drains the ring. The ring depth trades latency against
+// how long the renderer may fall behind before the output underruns.
+//
+// Sequencer events raised during feed() are queued with the ring position of
+// their buffer and handed to the original emitSignal callback by drain(), on
+// the draining thread, when the audio they belong to is drained.
+//
+// Other threads that call into the Sequencer while the render thread runs
+// must hold getSequencerMutex(); the render thread holds it for one feed().
+
+struct RenderStats {
+    int64_t renderedBuffers = 0;
+    int64_t underruns = 0;          // drain() calls that found fewer samples than requested
+    int64_t underrunFrames = 0;     // samples padded with silence
+    int64_t droppedEvents = 0;      // events lost to a full event queue
+    int32_t depthFrames = 0;
+    int32_t bufferedFrames = 0;
+    bool priorityRaised = false;    // the OS accepted the raised thread priority
+};
+
+class RenderThread {
+public:
+    static constexpr int32_t defaultDepthMs = 200;
+    static constexpr int32_t minDepthMs = 20;
+    static constexpr int32_t maxDepthMs = 2000;
+
+    explicit RenderThread(Sequencer &sequencer);
+    ~RenderThread();
+    RenderThread(const RenderThread &) = delete;
+    RenderThread &operator=(const RenderThread &) = delete;
+
+    // Starts rendering with a ring of depthMs (at least two feed() buffers).
+    // Call after Sequencer::initParam(). Returns false where threads are not
+    // available; the host keeps calling feed() itself then.
+    bool start(int32_t depthMs);
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+    int32_t getDepthMs() const { return depthMs; }
+
+    // Consumer side: fills 'frames' samples, padding with silence when the
+    // ring runs dry, and emits the events of the drained audio.
+    void drain(float *out, int32_t frames);
+
+    std::mutex &getSequencerMutex() { return sequencerMutex; }
+    RenderStats getStats() const;
+
+private:
+    struct TimedEvent {
+        uint64_t frame = 0;         // ring position of the buffer that raised it
+        EmittedEvent event;
+    };
+    static constexpr int32_t eventQueueSize = 4096;
+
+    void run();
+    static bool raisePriority();
+
+    Sequencer &sequencer;
+    std::mutex sequencerMutex;
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::atomic<bool> stopRequest{false};
+    SpscRing<float> ring;
+    SpscRing<TimedEvent> events;
+    std::function<void(const EmittedEvent&)> hostEmit;
+    std::vector<float> scratch;
+    int32_t depthMs = 0;
+    int32_t depthFrames = 0;
+    uint64_t producedFrames = 0;    // render thread only
+    uint64_t consumedFrames = 0;    // drain() only
+    bool primed = false;            // drain() only: the ring was full once, underruns count from here
+    std::atomic<int64_t> renderedBuffers{0};
+    std::atomic<int64_t> underruns{0};
+    std::atomic<int64_t> underrunFrames{0};
+    std::atomic<int64_t> droppedEvents{0};
+    std::atomic<bool> priorityRaised{false};
+};
+
+#endif // RENDER_THREAD_H
@@ -0,0 +1,2554 @@
+/**************************************************************************/
+/*  sequencer.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "sequencer.hpp"
+#include "pitch_mod.hpp"
+#include "lut_math.hpp"
+#include "debug_print.hpp"
+#include "denormals.hpp"
+
+#include "instrument.hpp"
+#include "shared_instruments.hpp"
+#include <algorithm> // for std::find, std::find_if, std::clamp
+#include <random> // for std::mt19937
+#include <tuple> // for std::tuple
+#include <complex> // for the wave mipmap synthesis
+#include <cstring> // for std::memset
+#include <chrono> // for the live input clock
+
+const char* scale[] = {" C", "C#", " D", "D#", " E", " F", "F#", " G", "G#", " A", "A#", " B"};
+
+// Fourier series of the naive wave shapes in SharedLUT::waveLUT:
+// wave(x) = sum of a*cos(h*x) + b*sin(h*x) over the harmonics h >= 1.
+static void baseWaveHarmonic(BaseWave wave, int32_t h, double &a, double &b) {
+    const double pi = 3.1415926535897932384626433833;
+    a = b = 0.0;
+    switch (wave) {
+        case BaseWave::WAVE_SIN:
+            b = (h == 1) ? 1.0 : 0.0;
+            break;
+        case BaseWave::WAVE_SQUARE:
+            b = (h % 2 == 1) ? 4.0 / (pi * h) : 0.0;
+            break;
+        case BaseWave::WAVE_TRIANGLE:
+            b = (h % 2 == 1) ? ((h % 4 == 1) ? 8.0 : -8.0) / (pi * pi * h * h) : 0.0;
+            break;
+        case BaseWave::WAVE_SAWTOOTH: // rising ramp, reset at 3/4 of the period
+            a = 2.0 / (pi * h) * sin(1.5 * pi * h);
+            b = -2.0 / (pi * h) * cos(1.5 * pi * h);
+            break;
+        case BaseWave::WAVE_SINSAWx2: // (sine + sawtooth at twice the frequency) / 2
+            if (h == 1) {
+                b = 0.5;
+            } else if (h % 2 == 0) {
+                baseWaveHarmonic(BaseWave::WAVE_SAWTOOTH, h / 2, a, b);
+                a *= 0.5;
+                b *= 0.5;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// In place x[j] = sum of x[k]*e^(2*pi*i*j*k/n), n a power of two.
+static void inverseFFT(std::vector<std::complex<double>> &x) {
+    const size_t n = x.size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(x[i], x[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double angle = 2.0 * 3.1415926535897932384626433833 / (double)len;
+        const std::complex<double> step(cos(angle), sin(angle));
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; k++) {
+                const std::complex<double> u = x[i + k];
+                const std::complex<double> v = x[i + k + len / 2] * w;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= step;
+            }
+        }
+    }
+}
+
+// Rate independent LUTs, evaluated by the compiler.
+template <int32_t size>
+static constexpr std::array<std::array<float, size>, static_cast<int32_t>(BaseWave::WAVE_TAIL)> makeWaveLUT() {
+    std::array<std::array<float, size>, static_cast<int32_t>(BaseWave::WAVE_TAIL)> lut{};
+    const int32_t s = size;
+    auto& sine = lut[static_cast<int32_t>(BaseWave::WAVE_SIN)];
+    auto& square = lut[static_cast<int32_t>(BaseWave::WAVE_SQUARE)];
+    auto& triangle = lut[static_cast<int32_t>(BaseWave::WAVE_TRIANGLE)];
+    auto& sawtooth = lut[static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH)];
+    auto& sinsaw = lut[static_cast<int32_t>(BaseWave::WAVE_SINSAWx2)];
+    for (int32_t i = 0; i < s; i++){
+        sine[i] = (float)gdsynth::lutmath::sin(2.0*gdsynth::lutmath::pi*(double)i/(double)s);
+        square[i] = (i < s/2) ? 1.0f : -1.0f;
+        triangle[(i+3*s/4)%s] = (i < s/2)?((float)i*4.0f)/((float)s)-1.0f:3.0f-((float)i*4.0f)/((float)s);
+        sawtooth[(i+3*s/4)%s] = ((float)i*2.0f)/((float)s)-1.0f;
+    }
+    for (int32_t i = 0; i < s; i++){
+        sinsaw[i] = ((sine[i]+1.0f)+(sawtooth[(i*2)%s]+1.0f))/2.0f -1.0f;
+    }
+    return lut;
+}
+
+template <int32_t size>
+static constexpr std::array<float, size> makePow2_x_1200LUT() {
+    std::array<float, size> lut{};
+    for (int32_t i = 0; i < size; i++){
+        lut[i] = (float)gdsynth::lutmath::exp(gdsynth::lutmath::ln2*(double)(i-size/2)/1200.0);
+    }
+    return lut;
+}
+
+static constexpr std::array<float, 128> makeVelocity2powerLUT() {
+    std::array<float, 128> lut{};
+    for (int32_t i = 0; i < 128; i++){
+        lut[i] = (float)gdsynth::lutmath::pow((double)(i+1)/128.0, 2.2);
+    }
+    return lut;
+}
+
+// 1 - (1-d)*(tanh(a*log(f/f_c))+1)/2 with a = 3. tanh(3*log(r)) is
+// (r^6-1)/(r^6+1), so the curve needs no transcendental functions.
+template <int32_t size>
+static constexpr std::array<float, size> makeLowFrequencyCorrectionLUT() {
+    std::array<float, size> lut{};
+    const double f_c = 440.0;  // Inflection point frequency
+    const double d = 0.33;  // Minimum coefficient
+    lut[0] = 1.0f; // f=0
+    for (int32_t i = 1; i < size; i++) {
+        const double r = (double)i * 8.0 / f_c;  // index to frequency (inverse of >>3)
+        const double r2 = r * r;
+        const double r6 = r2 * r2 * r2;
+        lut[i] = (float)(1.0 - (1.0 - d) * r6 / (r6 + 1.0));
+    }
+    return lut;
+}
+
+constexpr std::array<std::array<float, SharedLUT::waveLUTSize>, static_cast<int32_t>(BaseWave::WAVE_TAIL)> SharedLUT::waveLUT = makeWaveLUT<SharedLUT::waveLUTSize>();
+constexpr std::array<float, SharedLUT::pow2_x_1200LUT_size> SharedLUT::pow2_x_1200LUT = makePow2_x_1200LUT<SharedLUT::pow2_x_1200LUT_size>();
+constexpr std::array<float, 128> SharedLUT::velocity2powerLUT = makeVelocity2powerLUT();
+constexpr std::array<float, SharedLUT::lowFrequencyCorrectionLUT_size> SharedLUT::lowFrequencyCorrectionLUT = makeLowFrequencyCorrectionLUT<SharedLUT::lowFrequencyCorrectionLUT_size>();
+
+SharedLUT::SharedLUT() 
+    : numAtackSlopeLUT(0)
+    , numReleaseSlopeLUT(0)
+    , numDecaySlopeLUT(0)
+    , atackSlopeTime(0.0f)
+    , releaseSlopeTime(0.0f)
+    , decaySlopeTime(0.0f)
+    , atackSlopeHz(25.0f)
+    , releaseSlopeHz(25.0f)
+    , decaySlopeHz(1.0f)
+    , decayHalfLifeTime(50.0f)
+    , samplingRate(0.0f)
+    , noiseBufferSize(0)
+    , noiseGuardSize(0)
+    , tablesReady(true)
+{
+}
+
+SharedLUT& SharedLUT::getInstance() {
+    static SharedLUT instance; // initialized once, also when Sequencers are created on several threads
+    return instance;
+}
+
+void SharedLUT::addRef() {
+    std::lock_guard<std::mutex> lock(refMutex);
+    refCount++;
+}
+
+void SharedLUT::removeRef() {
+    std::lock_guard<std::mutex> lock(refMutex);
+    refCount--;
+    if (refCount <= 0) {
+        cleanup();
+        waveMipLUT.reset(); // rebuilt by the next initialize()
+        refCount = 0;
+    }
+}
+
+bool SharedLUT::initialize(float rate, int32_t noiseBufSize, int32_t noiseGuard) {
+    std::lock_guard<std::mutex> lock(refMutex);
+    // If already initialized with same parameters, skip
+    if (samplingRate == rate && noiseBufferSize == noiseBufSize && noiseGuardSize == noiseGuard) {
+        return true;
+    }
+
+    // Only cleanup if no other instances are using the LUTs
+    // Note: This assumes all instances use the same sampling rate/buffer size
+    if (samplingRate != 0.0f && (samplingRate != rate || noiseBufferSize != noiseBufSize || noiseGuardSize != noiseGuard)) {
+        // Only cleanup if we're the only reference
+        if (refCount <= 1) {
+            cleanup();
+        } else {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            gdsynth::print("[SharedLUT] init denied: samplingRate/noiseBufSize mismatch while refCount>1. current:", samplingRate, "/", noiseBufferSize, " requested:", rate, "/", noiseBufSize);
+#endif // DEBUG_ENABLED && WINDOWS_ENABLED
+            // Parameters changed but other instances exist - refuse to re-init
+            return false;
+        }
+    }
+    
+    samplingRate = rate;
+    noiseBufferSize = noiseBufSize;
+    noiseGuardSize = noiseGuard;
+    
+    // The tables take tens of milliseconds (mostly the noise LUTs and, the
+    // first time, the wave mipmaps), too long for the thread calling
+    // init_synthe. They are built on a worker; feed() waits for it.
+    const bool buildWaveMip = !waveMipLUT;
+    tablesReady.store(false, std::memory_order_relaxed);
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    buildTables(buildWaveMip);
+#else
+    pendingBuild = std::async(std::launch::async, [this, buildWaveMip]() { buildTables(buildWaveMip); });
+#endif
+    return true;
+}
+
+void SharedLUT::waitReady() {
+    if (tablesReady.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(buildMutex);
+    if (pendingBuild.valid()) {
+        pendingBuild.get();
+    }
+}
+
+void SharedLUT::buildTables(bool buildWaveMip) {
+    if (buildWaveMip) { // band-limited mipmaps of the naive shapes
+        waveMipLUT = std::make_unique<float[]>(getWaveMipLUTSize());
+        std::vector<std::complex<double>> spectrum;
+        for (int32_t w = 0; w < static_cast<int32_t>(BaseWave::WAVE_TAIL); w++) {
+            const BaseWave wave = static_cast<BaseWave>(w);
+            for (int32_t level = 0; level < waveMipLevels; level++) {
+                const int32_t size = waveMipSize(level);
+                const int32_t harmonics = waveMipTopHarmonics >> level;
+                spectrum.assign(size, std::complex<double>(0.0, 0.0));
+                for (int32_t h = 1; h <= harmonics; h++) {
+                    double a, b;
+                    baseWaveHarmonic(wave, h, a, b);
+                    spectrum[h] = std::complex<double>(a, -b);
+                }
+                inverseFFT(spectrum);
+                float* table = &waveMipLUT[getWaveMipOffset(wave, level)];
+                for (int32_t i = 0; i < size; i++) {
+                    table[i] = (float)spectrum[i].real();
+                }
+                table[size] = table[0];
+            }
+        }
+    }
+    
+    // Initialize slope LUTs (depends on sampling rate)
+    {
+        numAtackSlopeLUT = (int32_t)((1.0f/atackSlopeHz/2.0f)*samplingRate);
+        atackSlopeLUT = std::make_unique<float[]>(numAtackSlopeLUT);
+        atackSlopeTime = 1.0f/atackSlopeHz/2.0f*1000.0f;
+        for (int32_t i = 0; i < numAtackSlopeLUT; i++){
+            atackSlopeLUT[i] = (1.0f-cosf(PI*(float)i/(float)numAtackSlopeLUT))/2.0f;
+        }
+    }
+    {
+        numReleaseSlopeLUT = (int32_t)((1.0f/releaseSlopeHz/2.0f)*samplingRate);
+        releaseSlopeLUT = std::make_unique<float[]>(numReleaseSlopeLUT);
+        releaseSlopeTime = 1.0f/releaseSlopeHz/2.0f*1000.0f;
+        for (int32_t i = 0; i < numReleaseSlopeLUT; i++){
+            releaseSlopeLUT[i] = (1.0f+cosf(PI*(float)i/(float)numReleaseSlopeLUT))/2.0f;
+        }
+    }
+    {
+        numDecaySlopeLUT = (int32_t)((1.0f/decaySlopeHz/2.0f)*samplingRate);
+        decaySlopeLUT = std::make_unique<float[]>(numDecaySlopeLUT);
+        decaySlopeTime = 1.0f/decaySlopeHz/2.0f*1000.0f;
+        for (int32_t i = 0; i < numDecaySlopeLUT; i++){
+            decaySlopeLUT[i] = 0.5f+tanhf(log10f(decayHalfLifeTime/(decaySlopeTime*(float)i/(float)numDecaySlopeLUT)))/2.0f;
+        }
+    }
+    {
+        float offset = decaySlopeLUT[numDecaySlopeLUT-1];
+        float range = 1.0f - offset;
+        for (int32_t i = 0; i < numDecaySlopeLUT; i++){
+            decaySlopeLUT[i] = (decaySlopeLUT[i]-offset)/range;
+        }
+    }
+    
+    // Initialize noise LUTs (depends on buffer size)
+    {
+        // fixed seed keeps renders reproducible across runs and builds
+        std::mt19937 rand(0x6764736eu);
+        auto randRange = [&rand](double from, double to) {
+            return from + (to - from) * ((double)rand() / (double)std::mt19937::max());
+        };
+        whiteNoiseLUT = std::make_unique<float[]>(noiseBufferSize + noiseGuardSize);
+        triangularDistributionLUT = std::make_unique<float[]>(noiseBufferSize + noiseGuardSize);
+        cos4thPowDistributionLUT = std::make_unique<float[]>(noiseBufferSize + noiseGuardSize);
+        for (int32_t i = 0; i < noiseBufferSize; i++){
+            whiteNoiseLUT[i] = (float)randRange(-1.0, 1.0);
+            double r = std::fabs((double)whiteNoiseLUT[i]);
+            double c = std::fabs(1-pow(cos((double)PI*(r*0.5-0.5)), 4.0));
+            triangularDistributionLUT[i] = (float)randRange(-r, r);
+            cos4thPowDistributionLUT[i] = (float)randRange(-c, c);
+        }
+    }
+    
+    {
+        pinkNoiseLUT = std::make_unique<float[]>(noiseBufferSize + noiseGuardSize);
+        PinkNoise pinkNoise = PinkNoise();
+        for (int32_t i = 0; i < noiseBufferSize; i++){
+            pinkNoiseLUT[i] = pinkNoise.makeNoise(whiteNoiseLUT[i]);
+        }
+        float head = pinkNoiseLUT[0];
+        float tail = pinkNoise.makeNoise(whiteNoiseLUT[0]);
+        float diff = (tail- head)/(float)noiseBufferSize;
+        float max = -1.0f;
+        float min =  1.0f;
+        
+        for (int32_t i = 0; i < noiseBufferSize; i++){
+            pinkNoiseLUT[i] += diff*(float)i;
+            if (pinkNoiseLUT[i] > max) max = pinkNoiseLUT[i];
+            if (pinkNoiseLUT[i] < min) min = pinkNoiseLUT[i];
+        }
+        for (int32_t i = 0; i < noiseBufferSize; i++){
+            pinkNoiseLUT[i] = (pinkNoiseLUT[i] - min)/(max - min)*2.0f - 1.0f;
+        }
+    }
+    
+    // The guard repeats the head of each table so a block starting anywhere
+    // in the period can read past its end without wrapping.
+    for (int32_t i = 0; i < noiseGuardSize; i++){
+        int32_t src = i % noiseBufferSize;
+        whiteNoiseLUT[noiseBufferSize + i] = whiteNoiseLUT[src];
+        triangularDistributionLUT[noiseBufferSize + i] = triangularDistributionLUT[src];
+        cos4thPowDistributionLUT[noiseBufferSize + i] = cos4thPowDistributionLUT[src];
+        pinkNoiseLUT[noiseBufferSize + i] = pinkNoiseLUT[src];
+    }
+    
+    tablesReady.store(true, std::memory_order_release);
+}
+
+void SharedLUT::cleanup() {
+    waitReady();
+    atackSlopeLUT.reset();
+    releaseSlopeLUT.reset();
+    decaySlopeLUT.reset();
+    whiteNoiseLUT.reset();
+    pinkNoiseLUT.reset();
+    triangularDistributionLUT.reset();
+    cos4thPowDistributionLUT.reset();
+    // Note: waveLUT, pow2_x_1200LUT, velocity2powerLUT, and lowFrequencyCorrectionLUT are compile-time data,
+    // waveMipLUT doesn't depend on sampling rate and is reused
+    samplingRate = 0.0f;
+    noiseBufferSize = 0;
+    noiseGuardSize = 0;
+}
+
+PinkNoise::PinkNoise() {
+    for (int32_t i = 0; i < tapNum ; i++) z[i] = 0;
+    k[tapNum - 1] = 0.5f;
+    for (int32_t i = tapNum - 1; i > 0; i--)
+        k[i- 1] = k[i] * 0.25f;
+}
+
+PinkNoise::~PinkNoise() {
+}
+
+float PinkNoise::makeNoise(float in) {
+    float q = in;
+    for (int32_t i = 0; i < tapNum; i++) {
+        z[i] = (q*k[i] + z[i] * (1.0f - k[i]));
+        q = (q + z[i]) * 0.5f;
+    }
+    t = 0.75f * q + 0.25f * t;
+    return t;    
+}
+
+Sequencer::Sequencer() {
+    SharedLUT::getInstance().addRef();
+    instrumentBank = SharedInstruments::getInstance().getSnapshot();
+    eventQueue.reserve(initialEventCapacity);
+    liveQueue.reset(liveQueueSize);
+    livePending.reserve(liveQueueSize);
+    voiceKernel = selectVoiceKernel(renderKernel);
+}
+
+Sequencer::~Sequencer(){
+    SharedLUT::getInstance().removeRef();
+}
+
+float Sequencer::noteFrequency(int8_t note) {
+    return (powf(2.0f, ((float)note - 69.0f) / 12.0f)) * 440.0f;
+}
+
+// Note-on path (Hz, 1-cent steps). Per-sample modulation uses centToRatio().
+float Sequencer::centFrequency(float freq, float cent) {
+    const float* pow2LUT = SharedLUT::getInstance().getPow2_x_1200LUT();
+    const int32_t lutMid = SharedLUT::getPow2_x_1200LUT_size() / 2;
+    const int32_t lutMax = SharedLUT::getPow2_x_1200LUT_size() - 1;
+    const float limited = std::clamp(cent, -(float)lutMid, (float)lutMid);
+    const int32_t idx = std::clamp(lutMid + (int32_t)limited, 0, lutMax);
+    return std::min(freq * pow2LUT[idx], samplingRate*0.47f); // 0.47 is upper limit.
+}
+
+std::array<Instrument, Sequencer::numinstruments> Sequencer::getInstruments(void) const {
+    return SharedInstruments::getInstance().getSnapshot()->instruments;
+}
+
+
+void Sequencer::setInstruments(const std::array<Instrument, numinstruments>& source) {
+    int32_t WAVE_TAIL = static_cast<int32_t>(BaseWave::WAVE_TAIL)-1;
+    int32_t NOISECTYPE_TAIL = static_cast<int32_t>(NoiseColorType::NOISECTYPE_TAIL)-1;
+    int32_t NOISEDTYPE_TAIL = static_cast<int32_t>(NoiseDistributType::NOISEDTYPE_TAIL)-1;
+    auto instruments = source;
+    for (int32_t i = 0; i < numinstruments; i++) {
+        Instrument& inst = instruments[i];
+
+        inst.totalGain          = std::clamp(inst.totalGain, 0.0f, 1.0f);
+        inst.atackSlopeTime     = std::clamp(inst.atackSlopeTime, 0.0f, 5000.0f);
+        inst.decayHalfLifeTime  = std::clamp(inst.decayHalfLifeTime, 0.0f, 5000.0f);
+        inst.sustainRate        = std::clamp(inst.sustainRate, 0.0f, 1.0f);
+        inst.releaseSlopeTime   = std::clamp(inst.releaseSlopeTime, 0.0f, 5000.0f);
+
+        inst.baseVsOthersRatio  = std::clamp(inst.baseVsOthersRatio, 0.0f, 1.0f);
+        inst.side1VsSide2Ratio  = std::clamp(inst.side1VsSide2Ratio, 0.0f, 1.0f);
+        inst.baseOffsetCent1    = std::clamp(inst.baseOffsetCent1, -8400.0f, 8400.0f);
+        inst.baseWave1          = static_cast<BaseWave>(std::clamp(static_cast<int32_t>(inst.baseWave1), 0, WAVE_TAIL));
+        inst.baseOffsetCent2    = std::clamp(inst.baseOffsetCent2, -8400.0f, 8400.0f);
+        inst.baseWave2          = static_cast<BaseWave>(std::clamp(static_cast<int32_t>(inst.baseWave2), 0, WAVE_TAIL));
+        inst.baseOffsetCent3    = std::clamp(inst.baseOffsetCent3, -8400.0f, 8400.0f);
+        inst.baseWave3          = static_cast<BaseWave>(std::clamp(static_cast<int32_t>(inst.baseWave3), 0, WAVE_TAIL));
+
+        inst.noiseRatio         = std::clamp(inst.noiseRatio, 0.0f, 1.0f);
+        inst.noiseColorType     = static_cast<NoiseColorType>(std::clamp(static_cast<int32_t>(inst.noiseColorType), 0, NOISECTYPE_TAIL));
+
+        inst.delay0Time         = std::clamp(inst.delay0Time, 0.0f, 500.0f);
+        inst.delay1Time         = std::clamp(inst.delay1Time, 0.0f, 500.0f);
+        inst.delay2Time         = std::clamp(inst.delay2Time, 0.0f, 500.0f);
+        inst.delay0Ratio        = std::clamp(inst.delay0Ratio, 0.2f, 0.2f);
+        inst.delay1Ratio        = std::clamp(inst.delay1Ratio, 0.2f, 0.2f);
+        inst.delay2Ratio        = std::clamp(inst.delay2Ratio, 0.2f, 0.2f);
+
+        inst.freqNoiseCentRange = std::clamp(inst.freqNoiseCentRange, -8400.0f, 8400.0f);
+        inst.freqNoiseType      = static_cast<NoiseDistributType>(std::clamp(static_cast<int32_t>(inst.freqNoiseType), 0, NOISEDTYPE_TAIL));
+
+        inst.fmCentRange        = std::clamp(inst.fmCentRange, -8400.0f, 8400.0f);
+        inst.fmFreq             = std::clamp(inst.fmFreq, 0.0f, 7040.0f);
+        inst.fmPhaseOffset      = std::clamp(inst.fmPhaseOffset, 0.0f, 2.0f);
+        if (inst.fmPhaseOffset == 2.0f) inst.fmPhaseOffset = 0.0f;
+
+        inst.fmSync             = std::clamp(inst.fmSync, 0, 1);
+        inst.fmWave             = static_cast<BaseWave>(std::clamp(static_cast<int32_t>(inst.fmWave), 0, WAVE_TAIL));
+
+        inst.amLevel            = std::clamp(inst.amLevel, 0.0f, 1.0f);
+        inst.amFreq             = std::clamp(inst.amFreq, 0.0f, 7040.0f);
+        inst.amPhaseOffset      = std::clamp(inst.amPhaseOffset, 0.0f, 2.0f);
+        if (inst.amPhaseOffset == 2.0f) inst.amPhaseOffset = 0.0f;
+
+        inst.amSync             = std::clamp(inst.amSync, 0, 1);
+        inst.amWave             = static_cast<BaseWave>(std::clamp(static_cast<int32_t>(inst.amWave), 0, WAVE_TAIL));
+    }
+    SharedInstruments::getInstance().setInstruments(instruments);
+}
+
+
+// Derives the note-on state of every instrument. Runs on the first note-on
+// after the instruments or the sampling rate changed; the slope times it
+// reads are ready by then.
+void Sequencer::compilePatches(){
+    const auto& instruments = instrumentBank->instruments;
+    const auto& lut = SharedLUT::getInstance();
+    for (int32_t i = 0; i < numinstruments; i++) {
+        const Instrument& inst = instruments[i];
+        Patch& patch = patches[i];
+        patch = Patch();
+
+        patch.base1ratio = inst.baseVsOthersRatio;
+        patch.base2ratio = (1.0f-inst.baseVsOthersRatio)*inst.side1VsSide2Ratio;
+        patch.base3ratio = (1.0f-inst.baseVsOthersRatio)*(1.0f-inst.side1VsSide2Ratio);
+
+        patch.useFM = (inst.fmFreq != 0.0f) ? 1 : 0;
+        patch.fmSync = (inst.fmSync != 0) ? 1 : 0;
+        patch.fmPhase = PI * inst.fmPhaseOffset;
+        patch.fmIncrement = (2.0f * PI * inst.fmFreq) / samplingRate;
+        patch.useAM = (inst.amFreq != 0.0f) ? 1 : 0;
+        patch.amSync = (inst.amSync != 0) ? 1 : 0;
+        patch.amPhase = PI * inst.amPhaseOffset;
+        patch.amIncrement = (2.0f * PI * inst.amFreq) / samplingRate;
+
+        patch.freqNoiseCentharfRange = inst.freqNoiseCentRange*0.5f;
+        patch.useFreqNoise = (patch.freqNoiseCentharfRange != 0.0f) ? 1 : 0;
+        switch (inst.freqNoiseType) {
+            case NoiseDistributType::NOISEDTYPE_TRIANGULAR: patch.freqNoiseMode = 1; break;
+            case NoiseDistributType::NOISEDTYPE_COS4ThPOW:  patch.freqNoiseMode = 2; break;
+            default: patch.freqNoiseMode = 0; break;
+        }
+        patch.noiseColorMode = (inst.noiseColorType == NoiseColorType::NOISECTYPE_PINK) ? 1 : 0;
+
+        // wave mip level headroom: the base increment plus the upward pitch
+        // modulation must stay below the level's limit
+        float upCent = 2.0f*std::fabs(patch.freqNoiseCentharfRange);
+        if (patch.useFM) upCent += std::max(inst.fmCentRange, 0.0f);
+        patch.waveHeadroom = centToRatio(upCent);
+
+        patch.atackSlopeRatio = lut.getAtackSlopeTime()/inst.atackSlopeTime;
+        patch.decaySlopeRatio = lut.getDecayHalfLifeTime()/inst.decayHalfLifeTime;
+        patch.releaseSlopeRatio = lut.getReleaseSlopeTime()/inst.releaseSlopeTime;
+
+        // delay taps in samples; delays outside the ring or with no level are off
+        const float times[3] = {inst.delay0Time, inst.delay1Time, inst.delay2Time};
+        const float ratios[3] = {inst.delay0Ratio, inst.delay1Ratio, inst.delay2Ratio};
+        int32_t taps[3] = {0, 0, 0};
+        float tapRatios[3] = {0.0f, 0.0f, 0.0f};
+        float maxDelayTime = 0.0f;
+        for (int32_t t = 0; t < 3; t++) {
+            if (times[t] > 0.0f && times[t] < delayBufferDuration && ratios[t] < 1.00f && ratios[t] > 0.0f) {
+                taps[t] = (int32_t)((float)delayBufferSize * (times[t] / delayBufferDuration));
+                tapRatios[t] = ratios[t];
+                maxDelayTime = std::max(maxDelayTime, times[t]);
+                patch.delay.enabled = true;
+            }
+        }
+        const int32_t longest = std::max(taps[0], std::max(taps[1], taps[2]));
+        int32_t size = 1;
+        while (size <= longest) {
+            size <<= 1;
+        }
+        patch.delay.mask = std::min(size, delayBufferSize) - 1;
+        patch.delay.tap0 = taps[0];
+        patch.delay.tap1 = taps[1];
+        patch.delay.tap2 = taps[2];
+        patch.delay.ratio0 = tapRatios[0];
+        patch.delay.ratio1 = tapRatios[1];
+        patch.delay.ratio2 = tapRatios[2];
+        patch.delay.mainRatio = 1.0f - (tapRatios[0] + tapRatios[1] + tapRatios[2]);
+        patch.delay.tailSamples = (int32_t)(maxDelayTime * 3.0f * samplingRate / 1000.0f);
+        patch.delayPerVoice = (inst.delayPerVoice != 0) ? 1 : 0;
+
+        if (keyPatches[i]) {
+            std::fill(keyPatches[i].get(), keyPatches[i].get() + numKeys, KeyPatch());
+        }
+    }
+    patchGeneration = instrumentBank->generation;
+}
+
+
+// Pitch dependent note-on state of one key of one instrument, derived on the
+// key's first note.
+const Sequencer::KeyPatch& Sequencer::getKeyPatch(int32_t programNum, int32_t noteKey){
+    noteKey = std::clamp(noteKey, 0, numKeys - 1);
+    if (!keyPatches[programNum]) {
+        keyPatches[programNum] = std::make_unique<KeyPatch[]>(numKeys);
+    }
+    KeyPatch& keyPatch = keyPatches[programNum][noteKey];
+    if (keyPatch.valid) {
+        return keyPatch;
+    }
+    const Instrument& inst = instrumentBank->instruments[programNum];
+    const Patch& patch = patches[programNum];
+    keyPatch.frequency = noteFrequency((int8_t)noteKey);
+
+    float c1 = centFrequency(keyPatch.frequency, inst.baseOffsetCent1);
+    float l1 = centFrequency(c1, -(patch.freqNoiseCentharfRange));
+    keyPatch.baseIncrement1 = (2.0f * PI * l1) / samplingRate;
+
+    float c2 = centFrequency(keyPatch.frequency, inst.baseOffsetCent2);
+    float l2 = centFrequency(c2, -(patch.freqNoiseCentharfRange));
+    keyPatch.baseIncrement2 = (2.0f * PI * l2) / samplingRate;
+
+    float c3 = centFrequency(keyPatch.frequency, inst.baseOffsetCent3);
+    float l3 = centFrequency(c3, -(patch.freqNoiseCentharfRange));
+    keyPatch.baseIncrement3 = (2.0f * PI * l3) / samplingRate;
+
+    keyPatch.waveLevel1 = SharedLUT::getWaveMipLevel(std::min(keyPatch.baseIncrement1*patch.waveHeadroom, maxIncrement));
+    keyPatch.waveLevel2 = SharedLUT::getWaveMipLevel(std::min(keyPatch.baseIncrement2*patch.waveHeadroom, maxIncrement));
+    keyPatch.waveLevel3 = SharedLUT::getWaveMipLevel(std::min(keyPatch.baseIncrement3*patch.waveHeadroom, maxIncrement));
+    keyPatch.valid = true;
+    return keyPatch;
+}
+
+
+const std::array<Percussion, Sequencer::numPercussions>& Sequencer::getPercussions(void) const {
+    return percussions;
+}
+
+
+void Sequencer::setPercussions(const std::array<Percussion, numPercussions>& source) {
+    for (int32_t i = 0; i < numPercussions; i++) {
+        percussions[i].program = std::clamp(source[i].program, 0, 255);
+        percussions[i].key     = std::clamp(source[i].key, 0, 127);
+    }
+}
+
+
+void Sequencer::setControlParams(const ControlParams& params){
+    asumedConcurrentTone = std::clamp(params.divisionNum, 0.1f, 64.0f);
+    logLevel = std::clamp(params.logLevel, 0, 10);
+    preOnTime = std::clamp(params.preOnTime, 0.0f, 10000.0f);
+    // Set preOnTime to SMFParser for time offset calculation
+    midi.setPreOnTime(preOnTime);
+    masterKnee = std::clamp(params.masterKnee, 0.1f, 1.0f);
+    // power of two up to maxControlRate, so control steps tile the lane blocks
+    controlRate = 1;
+    while (controlRate * 2 <= std::min(params.controlRate, maxControlRate)) controlRate *= 2;
+    renderKernel = static_cast<RenderKernel>(std::clamp(static_cast<int32_t>(params.renderKernel), 0, static_cast<int32_t>(RenderKernel::RK_TAIL) - 1));
+    voiceKernel = selectVoiceKernel(renderKernel);
+    renderThreads = std::clamp(params.renderThreads, 1, maxRenderThreads);
+    workerPool.setThreads(renderThreads);
+    cullLevel = std::clamp(params.cullLevel, -200.0f, -20.0f);
+    cullGain = (cullLevel <= -200.0f) ? 0.0f : std::pow(10.0f, cullLevel / 20.0f);
+    prepareLaneGroups();
+    maxValue = 0.0;
+}
+
+ControlParams Sequencer::getControlParams(void) const {
+    ControlParams params;
+    params.divisionNum = asumedConcurrentTone;
+    params.logLevel = logLevel;
+    params.preOnTime = preOnTime;
+    params.renderKernel = renderKernel;
+    params.masterKnee = masterKnee;
+    params.controlRate = controlRate;
+    params.renderThreads = renderThreads;
+    params.cullLevel = cullLevel;
+    return params;
+}
+
+
+// Group outputs for the most tones the pool can hold and one lane scratch per
+// render thread, so the render path does not allocate.
+void Sequencer::prepareLaneGroups() {
+    if (voiceKernel == nullptr || bufferSamples <= 0) {
+        groupOut.clear();
+        laneScratch.clear();
+        return;
+    }
+    const int32_t width = voiceKernel->width;
+    const int32_t maxGroups = (numToneSlots + width - 1) / width;
+    groupOut.assign((size_t)maxGroups * (size_t)(width + 1) * (size_t)bufferSamples, 0.0f);
+    laneScratch.resize((size_t)workerPool.getThreads());
+}
+
+// Lays the tone SoA fields out in one block of numToneSlots entries each, every
+// field on its own cache line. Returns the bytes the layout needs; with a
+// null base only the size is computed.
+size_t Sequencer::bindToneFields(uint8_t* base) {
+    size_t offset = 0;
+    auto bind = [&](auto& field) {
+        using T = std::remove_reference_t<decltype(field[0])>;
+        offset = (offset + 63) & ~(size_t)63;
+        field.ptr = (base != nullptr) ? reinterpret_cast<T*>(base + offset) : nullptr;
+        offset += sizeof(T) * (size_t)numToneSlots;
+    };
+    auto bindAll = [&](auto&... fields) { (bind(fields), ...); };
+    bindAll(phase1, phase2, phase3, fmPhase, amPhase, fmIncrement, amIncrement,
+            baseIncrement1, baseIncrement2, baseIncrement3, frequency,
+            strength, atackedStrength, decayedStrength, atackedStrengthfloor,
+            atackSlopeRatio, decaySlopeRatio, releaseSlopeRatio,
+            base1ratio, base2ratio, base3ratio, freqNoiseCentharfRange,
+            velocity_f, restartVelocity_f, tempo_f, restartTempo_f,
+            waitDuration, restartWaitDuration, mainteinDuration, releaseTime,
+            noteStartTime, delayLineOfTone, passed, key,
+            waveLevel1, waveLevel2, waveLevel3, program,
+            velocity, restartVelocity, tempo, restartTempo,
+            useFM, useAM, useDelay, useFreqNoise, freqNoiseMode, noiseColorMode,
+            controlGain, controlRatio, toneEnded, toneFading, toneCulled, stealStamp);
+    return offset;
+}
+
+bool Sequencer::initParam(double rate, double time, int32_t samples, int32_t polyphony) {
+    // Validate parameters
+    if (rate <= 0.0 || samples <= 0) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("[Sequencer] initParam() invalid parameters: rate=", rate, ", samples=", samples);
+#endif // DEBUG_ENABLED && WINDOWS_ENABLED
+        return false;
+    }
+    
+    samplingRate = (float)rate;
+    bufferingTime = (float)time;
+    bufferSamples = samples;
+    blockSamples = samples;
+    currentTime = 0;
+    sequenceTime = 0.0;
+    noisePos = 0;
+    // the live input clock starts over; events stamped on the old one are dropped
+    LiveEvent staleEvent;
+    while (liveQueue.pop(staleEvent)) {}
+    livePending.clear();
+    sampleClock.store(0, std::memory_order_relaxed);
+    clockOrigin.store(0, std::memory_order_relaxed);
+    clockRate.store(rate / 1e9, std::memory_order_relaxed);
+    livePeriod.store(0, std::memory_order_relaxed);
+    liveApplied.store(0, std::memory_order_relaxed);
+    liveLate.store(0, std::memory_order_relaxed);
+    liveDropped.store(0, std::memory_order_relaxed);
+    noiseBufSize = (int32_t)(rate/(double)bufferSamples);
+    noiseBuffer = bufferSamples*noiseBufSize;
+    freeToneIndices.clear();
+    activeToneIndices.clear();
+
+    // Initialize shared LUTs
+    if (!SharedLUT::getInstance().initialize(samplingRate, noiseBuffer, bufferSamples)) {
+        return false;
+    }
+
+    // the pool is sized here, so the note-on and render paths do not allocate;
+    // an eighth more voices are kept for the fades of stolen ones
+    numTone = std::clamp(polyphony, 1, maxPolyphony);
+    numToneSlots = numTone + std::max(1, numTone / 8);
+    toneInstances.assign((size_t)numToneSlots, Tone());
+    freeToneIndices.reserve((size_t)numToneSlots);
+    activeToneIndices.reserve((size_t)numToneSlots);
+    stealHeap.clear();
+    stealHeap.reserve((size_t)numToneSlots * 2);
+    stealHeapValid = false;
+    fadingTones = 0;
+    stolenTones = 0;
+    renderToneIndices.reserve((size_t)numToneSlots);
+    cullStats = CullStats();
+    tonePoolSize = bindToneFields(nullptr) + 63;
+    tonePool.reset(static_cast<uint8_t*>(std::calloc(tonePoolSize, 1)));
+    if (!tonePool) {
+        return false;
+    }
+    bindToneFields(reinterpret_cast<uint8_t*>(((uintptr_t)tonePool.get() + 63) & ~(uintptr_t)63));
+    for (int32_t i = 0; i < numToneSlots; i++) {
+        freeToneIndices.push_back(i);
+    }
+
+    // make delay lines (chunked, power-of-two for mask); the first chunk now,
+    // the others when note-ons need them
+    int32_t requestedDelaySize = (int32_t)((float)rate*(delayBufferDuration/1000.0f));
+    if (requestedDelaySize < 1) requestedDelaySize = 1;
+    int32_t pow2 = 1;
+    while (pow2 < requestedDelaySize) {
+        pow2 <<= 1;
+    }
+    delayBufferSize = pow2;
+    maxDelayLines = numinstruments + numToneSlots;
+    delayLineChunks.clear();
+    delayLines.clear();
+    delayLines.reserve((size_t)maxDelayLines);
+    delayLineInput.clear();
+    delayLineInput.reserve((size_t)maxDelayLines * (size_t)bufferSamples);
+    delayBusOfProgram.fill(-1);
+    if (!growDelayLines()) {
+        return false;
+    }
+
+    SharedInstruments::getInstance().setInstruments(defaultInstruments);
+    percussions = defaultPercussions;
+    patchGeneration = 0; // compiled for this rate on the next note-on
+    prepareLaneGroups();
+
+    isSet = true;
+    return true;
+}
+
+
+bool Sequencer::smfUnload(void) {
+    unitOfTime = 60000.0;
+    midi.setUnitOfTime(unitOfTime); // milliseconds
+    freeToneIndices.clear();
+    activeToneIndices.clear();
+    for (int32_t i = 0; i < numToneSlots; i++) {
+        toneInstances[i].bank.reset();
+        freeToneIndices.push_back(i);
+    }
+    fadingTones = 0;
+    stealHeapValid = false;
+
+    midi.unload();
+    
+    return true;
+}
+
+
+bool Sequencer::smfLoad(const char *name, double givenUnitOfTime) {
+    currentTime = 0;
+    sequenceTime = 0.0;
+    unitOfTime = (float)givenUnitOfTime;
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+    gdsynth::print("unitOfTime ", unitOfTime);
+#endif // DEBUG_ENABLED
+
+    midi.setUnitOfTime(unitOfTime); // milliseconds
+    if (midi.load(name) == false) {
+        return false;
+    }
+    
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("smf file size: ", midi.filesize);
+#endif // DEBUG_ENABLED
+    return true;
+}
+
+
+bool Sequencer::smfLoad(const uint8_t *data, size_t size, double givenUnitOfTime) {
+    currentTime = 0;
+    sequenceTime = 0.0;
+    unitOfTime = (float)givenUnitOfTime;
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+    gdsynth::print("unitOfTime ", unitOfTime);
+#endif // DEBUG_ENABLED
+
+    midi.setUnitOfTime(unitOfTime); // milliseconds
+    if (midi.load(data, size) == false) {
+        return false;
+    }
+    
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("smf file size: ", midi.filesize);
+#endif // DEBUG_ENABLED
+    return true;
+}
+
+
+void Sequencer::smfAdopt(SMFParser &parsed, double givenUnitOfTime) {
+    currentTime = 0;
+    sequenceTime = 0.0;
+    unitOfTime = (float)givenUnitOfTime;
+    parsed.setUnitOfTime(unitOfTime); // milliseconds
+    parsed.setPreOnTime(midi.getPreOnTime());
+    std::swap(midi, parsed);
+}
+
+
+bool Sequencer::smfSeek(int32_t ms) {
+    if (!isSet || midi.getNumOfTracks() == 0) return false;
+
+    // the voices and delay tails of the old position stop at once
+    for (size_t tonePos = activeToneIndices.size(); tonePos-- > 0;) {
+        const int32_t toneIndex = activeToneIndices[tonePos];
+        Tone& tone = toneInstances[toneIndex];
+        if (tone.note.state != NState::NS_OFF) {
+            tone.note.state = NState::NS_OFF;
+            enqueueNoteEvent(0, tone, program[toneIndex], key[toneIndex]);
+        }
+        releaseTone(tonePos);
+    }
+    stealHeapValid = false;
+    for (DelayLine& line : delayLines) {
+        line.inUse = false;
+        line.tailLeft = 0;
+    }
+    delayBusOfProgram.fill(-1);
+    std::fill(delayLineInput.begin(), delayLineInput.end(), 0.0f);
+
+    std::vector<Note> held, heldPreOnOff;
+    // the pre-on notes announced at the old position will not get their
+    // note-offs from the sequence any more: they are turned off here
+    if (preOnTime > 0.0f) {
+        midi.getHeldPreOnOff(heldPreOnOff);
+        for (Note& note : heldPreOnOff) {
+            note.state = NState::NS_OFF;
+            note.velocity = 0;
+            enqueueNoteEvent(0, note, 2);
+        }
+    }
+    ms = midi.seek(ms, held, heldPreOnOff);
+    // the normal sequence is preOnTime behind the pre-on one
+    const int32_t delay = (preOnTime > 0.0f) ? (int32_t)preOnTime : 0;
+    sequenceTime = (double)(ms + delay);
+    currentTime = ms + delay;
+
+    // held notes restart on the first sample of the next block; note-ons never
+    // turned off (drums, one-shots) stay off once their decay is over
+    for (Note& note : heldPreOnOff) {
+        if (!mayStillSound(note, ms + delay - note.startTime)) continue;
+        note.startTime = currentTime;
+        checkNewNote(note, true);
+    }
+    for (Note& note : held) {
+        if (!mayStillSound(note, ms - note.startTime)) continue;
+        note.startTime = currentTime;
+        checkNewNote(note, false, 0);
+    }
+    return true;
+}
+
+
+// Whether a held note that started 'age' ms ago is still heard. Without sustain
+// the envelope reaches zero at the end of the decay LUT (see renderToneEnvelope()).
+bool Sequencer::mayStillSound(const Note &note, int32_t age) const {
+    if (!instrumentBank) return true;
+    int32_t programNum = note.program;
+    if (note.channel == 9 || note.channel == 25) {
+        programNum = percussions[std::clamp(note.key, 0, numPercussions - 1)].program;
+    } else if (note.program >= 0x70 && note.program < 0x80) {
+        programNum = percussions[note.program].program;
+    }
+    const Instrument& inst = instrumentBank->instruments[std::clamp(programNum, 0, numinstruments - 1)];
+    if (inst.sustainRate > 0.0f) return true;
+    const auto& lut = SharedLUT::getInstance();
+    const float decayTime = lut.getDecaySlopeTime() * inst.decayHalfLifeTime / lut.getDecayHalfLifeTime();
+    return (float)age <= inst.atackSlopeTime + decayTime;
+}
+
+
+int32_t Sequencer::getSongPosition() const {
+    const int32_t delay = (preOnTime > 0.0f) ? (int32_t)preOnTime : 0;
+    return std::clamp((int32_t)sequenceTime - delay, 0, midi.getLength());
+}
+
+
+bool Sequencer::incertNoteOn(Note oneNote, int64_t sampleTime){
+    oneNote.state     = NState::NS_ON_FOREVER;
+    oneNote.trackNum  = 0;
+    oneNote.channel   = std::clamp(oneNote.channel, 0, 31);
+    oneNote.key       = std::clamp(oneNote.key, 0, 127);
+    oneNote.velocity  = std::clamp(oneNote.velocity, 0, 127);
+    oneNote.program   = std::clamp(oneNote.program, 0, 255);
+    oneNote.startTick = 0;
+    oneNote.startTime = 0; // set when applied
+    oneNote.tempo     = std::clamp(oneNote.tempo, 1, 999);
+
+    LiveEvent ev;
+    ev.type = LiveEventType::LE_NOTE_ON;
+    ev.note = oneNote;
+    ev.sampleTime = (sampleTime < 0) ? stampLiveEvent() : sampleTime;
+    return postLiveEvent(ev);
+};
+
+
+bool Sequencer::incertNoteOff(Note oneNote, int64_t sampleTime){
+    oneNote.state     = NState::NS_OFF;
+    oneNote.trackNum  = 0;
+    oneNote.channel   = std::clamp(oneNote.channel, 0, 31);
+    oneNote.key       = std::clamp(oneNote.key, 0, 127);
+    oneNote.velocity  = std::clamp(oneNote.velocity, 0, 127);
+    oneNote.program   = std::clamp(oneNote.program, 0, 255);
+    oneNote.startTick = 0;
+    oneNote.startTime = 0; // set when applied
+    oneNote.tempo     = std::clamp(oneNote.tempo, 1, 999);
+
+    LiveEvent ev;
+    ev.type = LiveEventType::LE_NOTE_OFF;
+    ev.note = oneNote;
+    ev.sampleTime = (sampleTime < 0) ? stampLiveEvent() : sampleTime;
+    return postLiveEvent(ev);
+};
+
+
+bool Sequencer::postChannelPriority(int32_t channel, int32_t priority, int64_t sampleTime){
+    LiveEvent ev;
+    ev.type = LiveEventType::LE_CHANNEL_PRIORITY;
+    ev.note.channel = channel;
+    ev.value = priority;
+    ev.sampleTime = (sampleTime < 0) ? stampLiveEvent() : sampleTime;
+    return postLiveEvent(ev);
+}
+
+
+bool Sequencer::postLiveEvent(const LiveEvent &ev){
+    if (!liveQueue.push(ev)) {
+        liveDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+
+int64_t Sequencer::stampLiveEvent() const {
+    const int64_t origin = clockOrigin.load(std::memory_order_acquire);
+    const int32_t period = livePeriod.load(std::memory_order_relaxed);
+    if (origin == 0) {
+        return getSampleClock() + period; // not fed yet: the first block
+    }
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    const int64_t position = (int64_t)((double)(now - origin) * clockRate.load(std::memory_order_relaxed));
+    return position + period + period / 2;
+}
+
+
+LiveInputStats Sequencer::getLiveInputStats() const {
+    LiveInputStats stats;
+    stats.applied = liveApplied.load(std::memory_order_relaxed);
+    stats.late = liveLate.load(std::memory_order_relaxed);
+    stats.dropped = liveDropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+
+// Start of feed(): the sample clock position of its first sample belongs to
+// the current steady clock time. The origin follows these measurements
+// slowly, so the callback jitter does not move the stamps.
+void Sequencer::updateSampleClock(int32_t frames){
+    const double rate = clockRate.load(std::memory_order_relaxed);
+    if (rate <= 0.0) {
+        return; // before initParam()
+    }
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    const int64_t measured = now - (int64_t)((double)sampleClock.load(std::memory_order_relaxed) / rate);
+    int64_t origin = clockOrigin.load(std::memory_order_relaxed);
+    if (origin == 0 || std::abs(measured - origin) > (int64_t)(clockResyncMs * 1e6)) {
+        origin = measured;
+    } else {
+        origin += (measured - origin) / clockSmoothing;
+    }
+    clockOrigin.store(origin, std::memory_order_release);
+    if (frames > livePeriod.load(std::memory_order_relaxed)) {
+        livePeriod.store(frames, std::memory_order_relaxed);
+    }
+}
+
+
+// Takes the queued live events and applies the ones due before the end of
+// the block, in time order, at their sample offsets.
+void Sequencer::applyLiveEvents(){
+    const int64_t blockStart = sampleClock.load(std::memory_order_relaxed);
+    const int64_t blockEnd = blockStart + blockSamples;
+    LiveEvent ev;
+    while (livePending.size() < livePending.capacity() && liveQueue.pop(ev)) {
+        // equal times keep their queue order
+        auto it = std::upper_bound(livePending.begin(), livePending.end(), ev.sampleTime,
+                                   [](int64_t time, const LiveEvent &pending) { return time < pending.sampleTime; });
+        livePending.insert(it, ev);
+    }
+    const double samplesPerMs = (double)samplingRate / 1000.0;
+    size_t due = 0;
+    for (; due < livePending.size() && livePending[due].sampleTime < blockEnd; due++) {
+        const LiveEvent &event = livePending[due];
+        if (event.sampleTime < blockStart) {
+            liveLate.fetch_add(1, std::memory_order_relaxed);
+        }
+        const int32_t offset = (int32_t)std::max(event.sampleTime - blockStart, (int64_t)0);
+        if (event.type == LiveEventType::LE_CHANNEL_PRIORITY) {
+            setChannelPriority(event.note.channel, event.value);
+        } else {
+            Note oneNote = event.note;
+            oneNote.startTime = (int32_t)std::floor(sequenceTime + (double)offset / samplesPerMs);
+            checkNewNote(oneNote, false, offset);
+        }
+    }
+    livePending.erase(livePending.begin(), livePending.begin() + (ptrdiff_t)due);
+    liveApplied.fetch_add((int64_t)due, std::memory_order_relaxed);
+}
+
+void Sequencer::enqueueNoteEvent(int32_t onOff, const Tone& tone, int32_t instrumentNum, int32_t key2, int32_t msg) {
+    if (eventQueue.size() == eventQueue.capacity() && eventQueue.capacity() < maxEventCapacity) {
+        size_t newCap = std::min(static_cast<size_t>(maxEventCapacity), eventQueue.capacity() * 2);
+        eventQueue.reserve(newCap);
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("eventQueue expanded to ", (int32_t)newCap);
+#endif
+    }
+    if (eventQueue.size() < maxEventCapacity) {
+        EmittedEvent ev;
+        ev.msg = msg; // 0: normal note, 2: pre-on signal
+        ev.note.onOff = onOff;
+        ev.note.trackNum = tone.note.trackNum;
+        ev.note.channel = tone.note.channel;
+        ev.note.velocity = tone.note.velocity;
+        ev.note.program = tone.note.program;
+        ev.note.key = tone.note.key;
+        ev.note.instrumentNum = instrumentNum;
+        ev.note.key2 = key2;
+        eventQueue.push_back(ev);
+    }
+}
+
+void Sequencer::enqueueNoteEvent(int32_t onOff, const Note& note, int32_t msg) {
+    if (eventQueue.size() == eventQueue.capacity() && eventQueue.capacity() < maxEventCapacity) {
+        size_t newCap = std::min(static_cast<size_t>(maxEventCapacity), eventQueue.capacity() * 2);
+        eventQueue.reserve(newCap);
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("eventQueue expanded to ", (int32_t)newCap);
+#endif
+    }
+    if (eventQueue.size() < maxEventCapacity) {
+        EmittedEvent ev;
+        ev.msg = msg; // 2: pre-on/pre-off signal
+        ev.note.onOff = onOff;
+        ev.note.trackNum = note.trackNum;
+        ev.note.channel = note.channel;
+        ev.note.velocity = note.velocity;
+        ev.note.program = note.program;
+        ev.note.key = note.key;
+        ev.note.instrumentNum = note.program; // Use program as instrumentNum for preOnOff
+        ev.note.key2 = note.key; // Use key as key2 for preOnOff
+        eventQueue.push_back(ev);
+    }
+}
+
+void Sequencer::enqueueLevelEvent(double maxValue, double maxFrameValue, int32_t renderedSamples, int32_t skippedSamples) {
+    if (eventQueue.size() == eventQueue.capacity() && eventQueue.capacity() < maxEventCapacity) {
+        size_t newCap = std::min(static_cast<size_t>(maxEventCapacity), eventQueue.capacity() * 2);
+        eventQueue.reserve(newCap);
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("eventQueue expanded to ", (int32_t)newCap);
+#endif
+    }
+    if (eventQueue.size() < maxEventCapacity) {
+        EmittedEvent ev;
+        ev.msg = 1;
+        ev.level.max_level = (int32_t)(maxValue*1000.0);
+        ev.level.frame_level = (int32_t)(maxFrameValue*1000.0);
+        ev.level.rendered_samples = renderedSamples;
+        ev.level.skipped_samples = skippedSamples;
+        eventQueue.push_back(ev);
+    }
+}
+
+void Sequencer::flushEvents() {
+    if (emitSignal) {
+        for (const auto& ev : eventQueue) {
+            emitSignal(ev);
+        }
+    }
+    eventQueue.clear(); // keep capacity for reuse
+}
+
+
+bool Sequencer::checkNewNote(Note oneNote, bool forPreOnOff, int32_t sampleOffset){
+    // For preOnOff sequence, only process signals (no Tone allocation).
+    // The parser pairs each pre-on note-off with its note-on at load: it
+    // drops the unmatched ones and reports the program of the note-on.
+    if (forPreOnOff) {
+        enqueueNoteEvent((oneNote.state == NState::NS_ON_FOREVER) ? 1 : 0, oneNote, 2); // msg=2 for preOnOff signal
+        return true;
+    }
+    
+    float durationTime = 0;
+    if (oneNote.state == NState::NS_ON_FOREVER) durationTime = FLOAT_LONGTIME;
+    int32_t ringingIdx = -1;
+    // Search in reverse order to match the last (most recent) note_on (LIFO: Last In First Out)
+    // This matches MIDI specification where note_off matches the most recent note_on for the same channel/key
+    for (auto it = activeToneIndices.rbegin(); it != activeToneIndices.rend(); ++it) {
+        int32_t idx = *it;
+        const Tone& foundTone = toneInstances[idx];
+        if (oneNote.key == foundTone.note.key
+            && oneNote.channel == foundTone.note.channel
+            && foundTone.note.state != NState::NS_OFF) {
+            ringingIdx = idx;
+            break;
+        }
+    }
+    if (oneNote.state == NState::NS_OFF) {
+        if (ringingIdx >= 0) {
+            Tone& ringingTone = toneInstances[ringingIdx];
+            if (sampleOffset >= 0) {
+                // the release starts at that sample, in the tone's own time
+                const double offTime = passed[ringingIdx] + ((double)sampleOffset + 0.5) * 1000.0 / (double)samplingRate;
+                mainteinDuration[ringingIdx] = std::max((float)offTime - waitDuration[ringingIdx], 0.0f);
+            } else {
+                mainteinDuration[ringingIdx] = (float)(oneNote.startTime - ringingTone.note.startTime);
+            }
+            ringingTone.note.state = NState::NS_OFF;
+            pushStealEntry(ringingIdx);
+
+            enqueueNoteEvent(0, ringingTone, program[ringingIdx], key[ringingIdx]);
+
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            if (logLevel > 1){
+                gdsynth::print(
+                        "[note_off] matched: idx=", ringingIdx,
+                        " state ", static_cast<int32_t>(ringingTone.note.state),
+                        "  ch ", ringingTone.note.channel,
+                        "  prog ", ringingTone.note.program,
+                        "  key ", ringingTone.note.key,
+                        "  scale ", scale[ringingTone.note.key%12],(uint16_t)(ringingTone.note.key / 12) - 1,
+                        "  startTime(ms) ", ringingTone.note.startTime,
+                        "  offTime(ms) ", oneNote.startTime,
+                        "  mainteinDuration(ms) ", mainteinDuration[ringingIdx]
+                );
+            }
+#endif // DEBUG_ENABLED
+        }
+        else {
+            return true;
+        }
+    }
+    else {
+        // waitDuration calculation: oneNote.startTime already includes preOnTime offset from SMFParser.
+        // Tone time starts at the exact start of the block. The wait is put half a
+        // sample past the sample grid so a note lying on a sample starts on the same
+        // sample whatever the block size.
+        const double samplesPerMs = (double)samplingRate / 1000.0;
+        const double startSample = (sampleOffset >= 0) ? (double)sampleOffset
+                                 : std::floor(((double)oneNote.startTime - sequenceTime) * samplesPerMs + 1e-6);
+        const float wait = (float)((startSample + 0.5) / samplesPerMs);
+
+        int32_t idx = -1;
+        if ((int32_t)activeToneIndices.size() - fadingTones < numTone) {
+            idx = freeToneIndices.back();
+            freeToneIndices.pop_back();
+        } else {
+            idx = stealTone(wait);
+        }
+        if (idx < 0) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            gdsynth::print("Error: no free tone.");
+#endif // DEBUG_ENABLED
+            return true;
+        }
+        Tone& tone = toneInstances[idx];
+
+        tone.note = oneNote;
+
+        phase1[idx] = phase2[idx] = phase3[idx] = 0.0f;
+        key[idx] = oneNote.key;
+        passed[idx] = 0.0;
+        waitDuration[idx] = wait;
+        noteStartTime[idx] = oneNote.startTime; // Save oneNote.startTime (from normal sequence)
+
+        mainteinDuration[idx] = durationTime;
+        restartWaitDuration[idx] = FLOAT_LONGTIME;
+        restartTempo[idx] = tempo[idx] = oneNote.tempo;
+        restartTempo_f[idx] = tempo_f[idx] = (float)oneNote.tempo*1000.0f; // msec
+        restartVelocity[idx] = velocity[idx] = oneNote.velocity;
+
+        // select instrument
+        const auto& instruments = instrumentBank->instruments;
+        tone.bank = instrumentBank;
+        if (tone.note.channel > 127 || tone.note.channel < 0) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            gdsynth::print("invalid tone->note.channel ", tone.note.channel);
+#endif // DEBUG_ENABLED
+            program[idx] = 0;
+            tone.instrument = &instruments[0];
+            tone.note.velocity = 0;
+        }
+        else if (tone.note.channel == 9  || tone.note.channel == 25) { // 9 is ch10 that is reserved for Percussions.
+            program[idx] = percussions[tone.note.key].program;
+            tone.instrument = &instruments[percussions[tone.note.key].program];
+            key[idx] = percussions[tone.note.key].key;
+        }
+        else {
+            if (oneNote.program >= 0x70  && oneNote.program < 0x80){ // Percussives and Sound effects.
+                program[idx] = percussions[oneNote.program].program;
+                tone.instrument = &instruments[percussions[oneNote.program].program];
+                key[idx] = percussions[oneNote.program].key;
+            }
+            else{
+                program[idx] = oneNote.program;
+                tone.instrument = &instruments[oneNote.program];
+            }
+        }
+        if (patchGeneration != instrumentBank->generation) {
+            compilePatches();
+        }
+        const Patch& patch = patches[program[idx]];
+        const KeyPatch& keyPatch = getKeyPatch(program[idx], key[idx]);
+        useFM[idx] = patch.useFM;
+        useAM[idx] = patch.useAM;
+        enqueueNoteEvent(1, tone, program[idx], key[idx]);
+        {
+            auto& lut = SharedLUT::getInstance();
+            restartVelocity_f[idx] = velocity_f[idx] = lut.getVelocity2powerLUT()[tone.note.velocity];
+            atackedStrengthfloor[idx] = 0.0f;
+            strength[idx] = 0.0f;
+            atackedStrength[idx] = 0.0f;
+            decayedStrength[idx] = 0.0f;
+        }
+        base1ratio[idx] = patch.base1ratio;
+        base2ratio[idx] = patch.base2ratio;
+        base3ratio[idx] = patch.base3ratio;
+                
+        // control-rate ramps start from silence at the base pitch
+        controlGain[idx] = 0.0f;
+        controlRatio[idx] = 1.0f;
+
+        // fm / am moduration related, the tempo synced ones scale with the note's tempo
+        fmPhase[idx] = patch.fmPhase;
+        fmIncrement[idx] = patch.fmSync ? patch.fmIncrement * tempo_f[idx] / unitOfTime : patch.fmIncrement;
+        amPhase[idx] = patch.amPhase;
+        amIncrement[idx] = patch.amSync ? patch.amIncrement * tempo_f[idx] / unitOfTime : patch.amIncrement;
+
+        frequency[idx] = keyPatch.frequency;
+        freqNoiseCentharfRange[idx] = patch.freqNoiseCentharfRange;
+        baseIncrement1[idx] = keyPatch.baseIncrement1;
+        baseIncrement2[idx] = keyPatch.baseIncrement2;
+        baseIncrement3[idx] = keyPatch.baseIncrement3;
+        waveLevel1[idx] = keyPatch.waveLevel1;
+        waveLevel2[idx] = keyPatch.waveLevel2;
+        waveLevel3[idx] = keyPatch.waveLevel3;
+
+        // send to the program's delay bus, or to a line of its own
+        {
+            const int32_t line = acquireDelayLine(patch, program[idx]);
+            useDelay[idx] = (line >= 0) ? 1 : 0;
+            delayLineOfTone[idx] = std::max(line, 0);
+            if (line < 0 && patch.delay.enabled) {
+                // no line could be added: play dry at the level the bus would pass
+                velocity_f[idx] *= patch.delay.mainRatio;
+                restartVelocity_f[idx] *= patch.delay.mainRatio;
+            }
+        }
+
+        atackSlopeRatio[idx] = patch.atackSlopeRatio;
+        decaySlopeRatio[idx] = patch.decaySlopeRatio;
+        releaseSlopeRatio[idx] = patch.releaseSlopeRatio;
+        releaseTime[idx] = tone.instrument->releaseSlopeTime;
+        toneFading[idx] = 0;
+        toneCulled[idx] = 0;
+
+        // noise mode flags
+        useFreqNoise[idx] = patch.useFreqNoise;
+        freqNoiseMode[idx] = patch.freqNoiseMode;
+        noiseColorMode[idx] = patch.noiseColorMode;
+
+        activeToneIndices.push_back(idx);
+        pushStealEntry(idx);
+    }
+    return true;
+}
+
+
+// Rank of a tone for stealing, see StealEntry::before().
+Sequencer::StealEntry Sequencer::makeStealEntry(int32_t toneIndex) const {
+    const Tone& tone = toneInstances[toneIndex];
+    const float envelope = (passed[toneIndex] > waitDuration[toneIndex]) ? strength[toneIndex] : 1.0f;
+    StealEntry entry;
+    entry.held = (tone.note.state != NState::NS_OFF) ? 1 : 0;
+    entry.priority = channelPriority[std::clamp(tone.note.channel, 0, numChannels - 1)];
+    entry.level = envelope * velocity_f[toneIndex] * tone.instrument->totalGain;
+    entry.startTime = noteStartTime[toneIndex];
+    entry.toneIndex = toneIndex;
+    entry.stamp = stealStamp[toneIndex];
+    return entry;
+}
+
+// Called when a tone starts or is released: outdates its entry in the heap
+// and adds one with its new rank.
+void Sequencer::pushStealEntry(int32_t toneIndex) {
+    stealStamp[toneIndex]++;
+    if (stealHeapValid) {
+        stealHeap.push_back(makeStealEntry(toneIndex));
+        std::push_heap(stealHeap.begin(), stealHeap.end(), StealEntry::heapOrder);
+    }
+}
+
+// Makes room for a note-on starting 'wait' ms into the block when numTone
+// voices are playing, and returns the voice for it. The least important tone
+// fades out over stealFadeTime from the new note's start, or from the start
+// of the block when it is releasing by then so the fade starts from its level,
+// and the note takes a voice of the fade reserve. With the whole reserve still
+// fading the stolen tone is cut and its voice taken over. Returns -1 when
+// nothing can be stolen.
+int32_t Sequencer::stealTone(float wait) {
+    if (!stealHeapValid) {
+        // levels changed with the last render
+        stealHeap.clear();
+        for (int32_t toneIndex : activeToneIndices) {
+            if (toneFading[toneIndex] == 0) stealHeap.push_back(makeStealEntry(toneIndex));
+        }
+        std::make_heap(stealHeap.begin(), stealHeap.end(), StealEntry::heapOrder);
+        stealHeapValid = true;
+    }
+    int32_t victim = -1;
+    while (victim < 0 && !stealHeap.empty()) {
+        std::pop_heap(stealHeap.begin(), stealHeap.end(), StealEntry::heapOrder);
+        const StealEntry& top = stealHeap.back();
+        if (top.stamp == stealStamp[top.toneIndex] && toneFading[top.toneIndex] == 0) victim = top.toneIndex;
+        stealHeap.pop_back();
+    }
+    if (victim < 0) return -1;
+
+    Tone& tone = toneInstances[victim];
+    tone.note.state = NState::NS_OFF; // a later note-off does not match it
+    enqueueNoteEvent(0, tone, program[victim], key[victim]);
+    stolenTones++;
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+    if (logLevel > 1){
+        gdsynth::print("[steal] idx=", victim, " ch=", tone.note.channel, " key=", tone.note.key,
+                       " prog=", tone.note.program, " fading=", fadingTones);
+    }
+#endif // DEBUG_ENABLED
+    if (freeToneIndices.empty()) {
+        activeToneIndices.erase(std::find(activeToneIndices.begin(), activeToneIndices.end(), victim));
+        return victim;
+    }
+
+    const float blockStart = (float)passed[victim];
+    float fadeStart = blockStart + wait;
+    if (waitDuration[victim] + mainteinDuration[victim] < fadeStart) {
+        fadeStart = blockStart - 0.5f * (1000.0f / samplingRate);
+        decayedStrength[victim] = strength[victim];
+    }
+    mainteinDuration[victim] = std::max(fadeStart - waitDuration[victim], 0.0f);
+    releaseTime[victim] = stealFadeTime;
+    releaseSlopeRatio[victim] = SharedLUT::getInstance().getReleaseSlopeTime() / stealFadeTime;
+    toneFading[victim] = 1;
+    fadingTones++;
+
+    const int32_t toneIndex = freeToneIndices.back();
+    freeToneIndices.pop_back();
+    return toneIndex;
+}
+
+void Sequencer::setChannelPriority(int32_t channel, int32_t priority) {
+    if (channel < 0 || channel >= numChannels) return;
+    channelPriority[channel] = (int8_t)std::clamp(priority, -128, 127);
+}
+
+bool Sequencer::feed(float *frame){
+    return feed(frame, bufferSamples);
+}
+
+
+// Renders any number of samples, in blocks of at most bufferSamples. Sequence
+// time, tone time and the noise position advance by the samples rendered, so
+// the result does not depend on how the host splits its requests.
+bool Sequencer::feed(float *frame, int32_t frames){
+    SharedLUT::getInstance().waitReady(); // no-op once the tables of initParam() are built
+    SharedInstruments::getInstance().tryAcquire(instrumentBank); // edits apply from this buffer on
+    updateSampleClock(frames);
+    ScopedFlushDenormals flushDenormals;
+    for (int32_t offset = 0; offset < frames; offset += blockSamples) {
+        blockSamples = std::min(bufferSamples, frames - offset);
+        renderBlock(frame + offset);
+    }
+    blockSamples = bufferSamples;
+    return true;
+}
+
+
+void Sequencer::renderBlock(float *frame){
+    for (int i=0; i < blockSamples; i++) frame[i] = 0.0f;
+
+    // Sequence time is kept exact in double. The SMF side works in whole ms:
+    // a block takes the notes before its exact end, so a note never starts
+    // before its block.
+    const double blockEnd = sequenceTime + (double)blockSamples * 1000.0 / (double)samplingRate;
+    const int32_t blockEndTime = (int32_t)std::ceil(blockEnd);
+    
+    // Parse preOnOff sequence (if preOnTime > 0 and MIDI file is loaded)
+    // preOnOff sequence parses without delay (no preOnTime offset)
+    // The delay for normal sequence is handled in SMFParser::parse()
+    if (preOnTime > 0.0f && midi.getNumOfTracks() > 0) {
+        int32_t preOnOffTill = blockEndTime;
+        Note preNote;
+        while(isSet) {
+            preNote = midi.parse(preOnOffTill, true); // forPreOnOff = true
+            if (preNote.state == NState::NS_END || preNote.state == NState::NS_EMPTY) {
+                break;
+            }
+            checkNewNote(preNote, true); // forPreOnOff = true
+        }
+    }
+    
+    // Parse normal sequence
+    Note oneNote;
+    int32_t normalSequenceTill = blockEndTime;
+    while(isSet) {
+        oneNote = midi.parse(normalSequenceTill, false); // forPreOnOff = false
+        if (oneNote.state == NState::NS_END || oneNote.state == NState::NS_EMPTY) {
+            break;
+        }
+        checkNewNote(oneNote, false); // forPreOnOff = false
+    }
+    applyLiveEvents();
+    currentTime = blockEndTime;
+    sequenceTime = blockEnd;
+    int32_t noiseBufIndex = noisePos;
+    bool hasTones = !activeToneIndices.empty();
+    blockRenderedSamples = blockSkippedSamples = 0;
+    if (voiceKernel != nullptr) {
+        renderTonesLanes(frame, noiseBufIndex);
+    } else {
+        renderTonesScalar(frame, noiseBufIndex);
+    }
+    stealHeapValid = false; // tone levels moved on
+    cullStats.renderedVoiceSamples += blockRenderedSamples;
+    cullStats.skippedVoiceSamples += blockSkippedSamples;
+    // delay tails keep sounding after their voices ended
+    if (renderDelayLines(frame)) hasTones = true;
+    // master stage: the only clipping point of the mix
+    float maxFrameValue = (voiceKernel != nullptr) ? voiceKernel->master(frame, blockSamples, masterKnee)
+                                                   : masterStageScalar(frame, blockSamples, masterKnee);
+    if (hasTones) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        if (maxFrameValue > 1.0f) gdsynth::print("saturated! ", maxFrameValue);
+#endif // DEBUG_ENABLED
+        if (maxFrameValue > maxValue) maxValue = maxFrameValue;
+        enqueueLevelEvent(maxValue, maxFrameValue, blockRenderedSamples, blockSkippedSamples);
+    }
+    noisePos = (noisePos + blockSamples) % noiseBuffer;
+    sampleClock.store(sampleClock.load(std::memory_order_relaxed) + blockSamples, std::memory_order_release);
+
+    if (oneNote.state == NState::NS_END && activeToneIndices.empty()){
+        midi.restart();
+        currentTime = 0; // or executed immediately without waiting.
+        sequenceTime = 0.0;
+    }
+    // flush queued events
+    flushEvents();
+}
+
+
+// Reference path: one tone at a time, one sample at a time.
+void Sequencer::renderTonesScalar(float *frame, int32_t noiseBufIndex){
+    auto& lut = SharedLUT::getInstance();
+    const auto& waveLUT = lut.getWaveLUT();
+    float period = (float)std::size(waveLUT[0])/(PI*2.0f);
+    const float phaseToIndex = period; // phase(rad) -> LUT index scale
+    const float* waveMipLUT = lut.getWaveMipLUT();
+    // Precompute reciprocals to reduce divides (WASM branch/division reduction)
+    float invSamplingRate = 1.0f / samplingRate;
+    float delta = invSamplingRate * 1000.0f;
+    const double blockTime = (double)blockSamples * 1000.0 / (double)samplingRate;
+    float div = 1.0f/asumedConcurrentTone; // to avoid saturation.
+
+    // Hot-path LUT pointers (hoisted out of loop for SIMD readiness)
+    const float* whiteLUT = lut.getWhiteNoiseLUT();
+    const float* triangularLUT = lut.getTriangularDistributionLUT();
+    const float* cos4thPowLUT = lut.getCos4thPowDistributionLUT();
+    const float* pinkLUT = lut.getPinkNoiseLUT();
+    
+    // Precompute frequency scale for low frequency correction (outside loop)
+    const float* lfcLUT = lut.getLowFrequencyCorrectionLUT();
+    const float freqScale = samplingRate / (2.0f * PI);
+
+    for (size_t tonePos = 0; tonePos < activeToneIndices.size();) {
+        int32_t toneIndex = activeToneIndices[tonePos];
+        if (toneCulled[toneIndex] != 0) {
+            blockSkippedSamples += blockSamples;
+            passed[toneIndex] += blockTime;
+            if (cullTone(toneIndex)) {
+                releaseTone(tonePos);
+                continue;
+            }
+            tonePos++;
+            continue;
+        }
+        blockRenderedSamples += blockSamples;
+        Tone& toneRef = toneInstances[toneIndex];
+        float current = (float)passed[toneIndex];
+        float& ph1 = phase1[toneIndex];
+        float& ph2 = phase2[toneIndex];
+        float& ph3 = phase3[toneIndex];
+        float& st = strength[toneIndex];
+        float& atkSt = atackedStrength[toneIndex];
+        float& decSt = decayedStrength[toneIndex];
+        float& atkFloor = atackedStrengthfloor[toneIndex];
+        float& fmPh = fmPhase[toneIndex];
+        float& fmInc = fmIncrement[toneIndex];
+        float& amPh = amPhase[toneIndex];
+        float& amInc = amIncrement[toneIndex];
+        float& wt = waitDuration[toneIndex];
+        float& rw = restartWaitDuration[toneIndex];
+        float& md = mainteinDuration[toneIndex];
+        float& atkRatio = atackSlopeRatio[toneIndex];
+        float& decRatio = decaySlopeRatio[toneIndex];
+        float& relRatio = releaseSlopeRatio[toneIndex];
+        float& b1ratio = base1ratio[toneIndex];
+        float& b2ratio = base2ratio[toneIndex];
+        float& b3ratio = base3ratio[toneIndex];
+        float& velF = velocity_f[toneIndex];
+        float& rVelF = restartVelocity_f[toneIndex];
+        const float* freqNoiseLUT = (freqNoiseMode[toneIndex] == 1) ? triangularLUT
+                                     : (freqNoiseMode[toneIndex] == 2) ? cos4thPowLUT
+                                     : whiteLUT;
+        const float* noiseMixLUT = (noiseColorMode[toneIndex] == 1) ? pinkLUT : whiteLUT;
+        bool doFM = (useFM[toneIndex] != 0);
+        bool doAM = (useAM[toneIndex] != 0);
+        bool doDelay = (useDelay[toneIndex] != 0);
+        float* delayInput = delayLineInput.data() + (size_t)delayLineOfTone[toneIndex] * (size_t)bufferSamples;
+        if (doDelay) delayLines[delayLineOfTone[toneIndex]].hasInput = true;
+        bool doFreqNoise = (useFreqNoise[toneIndex] != 0);
+        const float noiseRatio = toneRef.instrument->noiseRatio;
+        bool doNoiseMix = (noiseRatio != 0.0f);
+        bool isEnd = false;
+        const float* waveTable1 = waveMipLUT + SharedLUT::getWaveMipOffset(toneRef.instrument->baseWave1, waveLevel1[toneIndex]);
+        const float* waveTable2 = waveMipLUT + SharedLUT::getWaveMipOffset(toneRef.instrument->baseWave2, waveLevel2[toneIndex]);
+        const float* waveTable3 = waveMipLUT + SharedLUT::getWaveMipOffset(toneRef.instrument->baseWave3, waveLevel3[toneIndex]);
+        const int32_t waveMask1 = SharedLUT::getWaveMipSize(waveLevel1[toneIndex]) - 1;
+        const int32_t waveMask2 = SharedLUT::getWaveMipSize(waveLevel2[toneIndex]) - 1;
+        const int32_t waveMask3 = SharedLUT::getWaveMipSize(waveLevel3[toneIndex]) - 1;
+        const float waveScale1 = (float)(waveMask1 + 1)/(PI*2.0f);
+        const float waveScale2 = (float)(waveMask2 + 1)/(PI*2.0f);
+        const float waveScale3 = (float)(waveMask3 + 1)/(PI*2.0f);
+        int32_t fmWave = static_cast<int32_t>(toneRef.instrument->fmWave);
+        float fmWaveInvert = 1.0f;
+        if (toneRef.instrument->fmWave == BaseWave::WAVE_SINSAWx2){
+            fmWave = static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH);
+            fmWaveInvert = -1.0f;
+        }
+        int32_t amWave = static_cast<int32_t>(toneRef.instrument->amWave);
+        float amWaveInvert = 1.0f;
+        if (toneRef.instrument->amWave == BaseWave::WAVE_SINSAWx2){
+            amWave = static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH);
+            amWaveInvert = -1.0f;
+        }
+        const float sustainRate = toneRef.instrument->sustainRate;
+        const float fmCentRange = toneRef.instrument->fmCentRange;
+        const float amLevel = toneRef.instrument->amLevel;
+        const float totalGain = toneRef.instrument->totalGain;
+        const float atackSlopeTime = toneRef.instrument->atackSlopeTime;
+        const float releaseSlopeTime = releaseTime[toneIndex];
+        const float releaseStart = wt + md;
+        const float releaseEnd = releaseStart + releaseSlopeTime;
+        const float attackEnd = wt + atackSlopeTime;
+        
+        // Note: pre_note_on/pre_note_off signals are emitted from preOnOff sequence events only
+        // (not from feed loop) to match the timing with normal onOff signals
+        
+#if defined(GDSYNTH_USE_X86_SIMD)
+#pragma GCC ivdep
+#pragma GCC unroll 4
+#endif
+        // SIMD hot path start: envelope + phase update + noise + AM/FM + mix + delay
+        for (int32_t i = 0; i < blockSamples; i++){
+            bool isTone = false;
+            if (current > rw) {
+                toneRef.note.state = NState::NS_ON_FOREVER;
+                md = rw = FLOAT_LONGTIME;
+                atkFloor = st;
+                wt = current;
+                tempo_f[toneIndex] = restartTempo_f[toneIndex];
+                velF = rVelF;
+            }
+            if (current > releaseEnd){
+                isEnd = true;
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+                if (logLevel > 1){
+                    gdsynth::print(
+                            "[envelope] tone ended: idx=", toneIndex,
+                            " ch=", toneRef.note.channel,
+                            " key=", toneRef.note.key,
+                            " prog=", toneRef.note.program,
+                            " current(ms)=", current,
+                            " releaseEnd(ms)=", releaseEnd
+                    );
+                }
+#endif // DEBUG_ENABLED
+                break;
+            }
+            else if (current > releaseStart){ // release
+                int32_t d = (int32_t)(((current-(wt+md))*relRatio)/delta);
+                const float* releaseLUT = lut.getReleaseSlopeLUT();
+                if (d >= lut.getNumReleaseSlopeLUT()) d = lut.getNumReleaseSlopeLUT() - 1;
+                atkFloor = st = decSt*releaseLUT[d];
+                isTone = true;
+            }
+            else if (current > attackEnd){ // decay and sustain
+                int32_t d = (int32_t)(((current-attackEnd)*decRatio)/delta);
+                const float* decayLUT = lut.getDecaySlopeLUT();
+                if (d >= lut.getNumDecaySlopeLUT()) d = lut.getNumDecaySlopeLUT() - 1;
+                st = atkSt*((decayLUT[d]*(1.0f-sustainRate)+sustainRate));
+                atkFloor = decSt = st;
+                isTone = true;
+            }
+            else if (current > wt){ // atack
+                int32_t d = (int32_t)((current-wt)*atkRatio/delta);
+                const float* atackLUT = lut.getAtackSlopeLUT();
+                if (d >= lut.getNumAtackSlopeLUT()) d = lut.getNumAtackSlopeLUT() - 1;
+                st = atackLUT[d]*(1.0f-atkFloor)+atkFloor;
+                decSt = atkSt = st;
+                isTone = true;
+            }
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            if (atkSt > 1.0f) gdsynth::print("atackedStrength saturated! ", atkSt);
+            if (decSt > 1.0f) gdsynth::print("decayedStrength saturated! ", decSt);
+            if (st > 1.0f)    gdsynth::print("strength saturated! ", st);
+            if (atkSt < 0.0f) gdsynth::print("atackedStrength underflowed! ", atkSt);
+            if (decSt < 0.0f) gdsynth::print("decayedStrength underflowed! ", decSt);
+            if (st < 0.0f)    gdsynth::print("strength underflowed! ", st);
+#endif // DEBUG_ENABLED
+            if (isTone){
+                float inc1, inc2, inc3;
+                float cent = 0.0f;
+                if (doFreqNoise) {
+                    cent = freqNoiseCentharfRange[toneIndex]*freqNoiseLUT[noiseBufIndex+i];
+                }
+                if (doFM && current > wt){
+                    fmPh += fmInc;
+                    if (fmPh > PI*2.0f) fmPh -= PI*2.0f;
+                    int32_t fmIdx = (int32_t)(fmPh * phaseToIndex) & 0x0FFF; // Clamp to waveLUTSize-1 (4095)
+                    cent += fmCentRange*(waveLUT[fmWave][fmIdx]*fmWaveInvert+1.0f)*0.5f;
+                }
+                
+                inc1 = baseIncrement1[toneIndex];
+                inc2 = baseIncrement2[toneIndex];
+                inc3 = baseIncrement3[toneIndex];
+                if (doFM || doFreqNoise) {
+                    const float ratio = centToRatio(cent);
+                    inc1 = std::min(inc1*ratio, maxIncrement);
+                    inc2 = std::min(inc2*ratio, maxIncrement);
+                    inc3 = std::min(inc3*ratio, maxIncrement);
+                }
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+                if (inc1 < 0.0f) gdsynth::print("inc1 is going backwards! ", inc1);
+                if (inc2 < 0.0f) gdsynth::print("inc2 is going backwards! ", inc2);
+                if (inc3 < 0.0f) gdsynth::print("inc3 is going backwards! ", inc3);
+#endif // DEBUG_ENABLED
+                
+                ph1 += inc1;
+                if (ph1 > PI*2.0f) ph1 -= PI*2.0f;
+                ph2 += inc2;
+                if (ph2 > PI*2.0f) ph2 -= PI*2.0f;
+                ph3 += inc3;
+                if (ph3 > PI*2.0f) ph3 -= PI*2.0f;
+                
+                float level = 1.0f;
+                if (doAM && current > wt){
+                    amPh += amInc;
+                    if (amPh > PI*2.0f) amPh -= PI*2.0f;
+                    int32_t amIdx = (int32_t)(amPh * phaseToIndex) & 0x0FFF; // Clamp to waveLUTSize-1 (4095)
+                    level = (amLevel)*(waveLUT[amWave][amIdx]*amWaveInvert+1.0f)*0.5f;
+                    level += 1.0f - amLevel;
+                }
+
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+                if (level > 1.0f) gdsynth::print("level saturated! ", level);
+#endif // DEBUG_ENABLED
+                
+                float tone1, tone2, tone3;
+                {
+                    // band-limited table of the voice's mip level, linear interpolation
+                    float pos1 = ph1 * waveScale1;
+                    float pos2 = ph2 * waveScale2;
+                    float pos3 = ph3 * waveScale3;
+                    int32_t idx1 = (int32_t)pos1;
+                    int32_t idx2 = (int32_t)pos2;
+                    int32_t idx3 = (int32_t)pos3;
+                    float frac1 = pos1 - (float)idx1;
+                    float frac2 = pos2 - (float)idx2;
+                    float frac3 = pos3 - (float)idx3;
+                    const float* g1 = waveTable1 + (idx1 & waveMask1);
+                    const float* g2 = waveTable2 + (idx2 & waveMask2);
+                    const float* g3 = waveTable3 + (idx3 & waveMask3);
+
+                    tone1 = (g1[0] + (g1[1] - g1[0]) * frac1)*b1ratio;
+                    tone2 = (g2[0] + (g2[1] - g2[0]) * frac2)*b2ratio;
+                    tone3 = (g3[0] + (g3[1] - g3[0]) * frac3)*b3ratio;
+                }
+                
+                // Apply low frequency correction
+                float freq1 = inc1 * freqScale;
+                float freq2 = inc2 * freqScale;
+                float freq3 = inc3 * freqScale;
+                int32_t idx1 = (int32_t)(freq1) >> 3;
+                int32_t idx2 = (int32_t)(freq2) >> 3;
+                int32_t idx3 = (int32_t)(freq3) >> 3;
+                tone1 *= lfcLUT[idx1];
+                tone2 *= lfcLUT[idx2];
+                tone3 *= lfcLUT[idx3];
+                
+                float data = tone1+tone2+tone3;
+                
+                if (doNoiseMix) {
+                    data = data*(1.0f - noiseRatio)+noiseMixLUT[noiseBufIndex+i]*noiseRatio;
+                }
+
+                data *= (velF*st*div*level)*totalGain;
+
+                if (doDelay) {
+                    delayInput[i] += data;
+                } else {
+                    frame[i] += data;
+                }
+            }
+            current += delta;
+        }
+        // SIMD hot path end
+        if (isEnd && rw == FLOAT_LONGTIME){
+            releaseTone(tonePos);
+            continue;
+        }
+        passed[toneIndex] += blockTime;
+        if (cullTone(toneIndex)) {
+            releaseTone(tonePos);
+            continue;
+        }
+        tonePos++;
+    }
+}
+
+
+// Lane path: the active tones are rendered in groups of voiceKernel->width,
+// one job of the worker pool per group (see renderLaneGroup()). The groups'
+// outputs are then summed into the frame and the delay inputs in group and
+// lane order, the same order a single thread adds them in, and the ended
+// tones are released here, so the result and the events do not depend on
+// renderThreads.
+void Sequencer::renderTonesLanes(float *frame, int32_t noiseBufIndex){
+    const int32_t width = voiceKernel->width;
+    renderToneIndices.clear();
+    for (int32_t toneIndex : activeToneIndices) {
+        if (toneCulled[toneIndex] != 0) {
+            blockSkippedSamples += blockSamples;
+        } else {
+            renderToneIndices.push_back(toneIndex);
+        }
+    }
+    const int32_t numActive = (int32_t)renderToneIndices.size();
+    const int32_t numGroups = (numActive + width - 1) / width;
+    blockRenderedSamples += numActive * blockSamples;
+    const size_t groupStride = (size_t)(width + 1) * (size_t)bufferSamples;
+
+    auto job = [&](int32_t group, int32_t thread) {
+        ScopedFlushDenormals flushDenormals; // on the pool's threads as well
+        const int32_t groupTop = group * width;
+        float* dry = groupOut.data() + (size_t)group * groupStride;
+        renderLaneGroup(groupTop, std::min(width, numActive - groupTop), laneScratch[thread], noiseBufIndex, dry, dry + bufferSamples);
+    };
+    workerPool.run(numGroups, job);
+
+    for (int32_t group = 0; group < numGroups; group++) {
+        const int32_t groupTop = group * width;
+        const int32_t lanes = std::min(width, numActive - groupTop);
+        const float* dry = groupOut.data() + (size_t)group * groupStride;
+        for (int32_t lane = 0; lane < lanes; lane++) {
+            const int32_t toneIndex = renderToneIndices[groupTop + lane];
+            if (useDelay[toneIndex] == 0) continue;
+            const float* send = dry + (size_t)(lane + 1) * (size_t)bufferSamples;
+            float* input = delayLineInput.data() + (size_t)delayLineOfTone[toneIndex] * (size_t)bufferSamples;
+            for (int32_t i = 0; i < blockSamples; i++) {
+                input[i] += send[i];
+            }
+            delayLines[delayLineOfTone[toneIndex]].hasInput = true;
+        }
+        for (int32_t i = 0; i < blockSamples; i++) {
+            frame[i] += dry[i];
+        }
+    }
+
+    const double blockTime = (double)blockSamples * 1000.0 / (double)samplingRate;
+    for (size_t tonePos = 0; tonePos < activeToneIndices.size();) {
+        const int32_t toneIndex = activeToneIndices[tonePos];
+        if (toneEnded[toneIndex] != 0 && restartWaitDuration[toneIndex] == FLOAT_LONGTIME){
+            releaseTone(tonePos);
+            continue;
+        }
+        passed[toneIndex] += blockTime;
+        if (cullTone(toneIndex)) {
+            releaseTone(tonePos);
+            continue;
+        }
+        tonePos++;
+    }
+}
+
+
+// Returns the tone at 'tonePos' of activeToneIndices to the free voices once
+// its release (or the fade of a stolen tone) is over.
+void Sequencer::releaseTone(size_t tonePos){
+    const int32_t toneIndex = activeToneIndices[tonePos];
+    phase1[toneIndex] = phase2[toneIndex] = phase3[toneIndex] = 0.0f;
+    strength[toneIndex] = 0.0f;
+    atackedStrength[toneIndex] = 0.0f;
+    decayedStrength[toneIndex] = 0.0f;
+    if (toneFading[toneIndex] != 0) {
+        toneFading[toneIndex] = 0;
+        fadingTones--;
+    }
+    toneInstances[toneIndex].bank.reset();
+    freeToneIndices.push_back(toneIndex);
+    activeToneIndices[tonePos] = activeToneIndices.back();
+    activeToneIndices.pop_back();
+}
+
+
+// Audibility check of a tone after its buffer, 'passed' already advanced.
+// Past the attack the envelope only falls (a pending restart aside), so once
+// its gain is below cullGain the tone stays inaudible. A held tone stops
+// rendering; a released one is retired (returns true) and the rest of its
+// release is counted as skipped.
+bool Sequencer::cullTone(int32_t toneIndex){
+    if (restartWaitDuration[toneIndex] != FLOAT_LONGTIME) return false;
+    const Instrument* instrument = toneInstances[toneIndex].instrument;
+    const float now = (float)passed[toneIndex];
+    const float wt = waitDuration[toneIndex];
+    if (now <= wt + instrument->atackSlopeTime) return false;
+    const float gain = velocity_f[toneIndex] * strength[toneIndex] * instrument->totalGain / asumedConcurrentTone;
+    if (gain >= cullGain) return false;
+    const bool counted = (toneCulled[toneIndex] != 0);
+    if (!counted) cullStats.culledVoices++;
+    const float releaseStart = wt + mainteinDuration[toneIndex];
+    if (now <= releaseStart) {
+        toneCulled[toneIndex] = 1;
+        return false;
+    }
+    const float rest = releaseStart + releaseTime[toneIndex] - now;
+    blockSkippedSamples += (int32_t)std::max(rest * samplingRate / 1000.0f, 0.0f);
+    return true;
+}
+
+
+// One group of up to 'width' tones. Per block, the scalar control stage fills
+// phase increments and gains for each lane, the kernel renders all lanes at
+// once, the delayed lanes are moved to their send buffer and the rest are
+// summed into 'dry'. Touches only the group's tones and its outputs, so groups
+// may run on any thread.
+void Sequencer::renderLaneGroup(int32_t groupTop, int32_t lanes, LaneScratch &scratch, int32_t noiseBufIndex, float *dry, float *sends){
+    auto& lut = SharedLUT::getInstance();
+    const int32_t width = voiceKernel->width;
+
+    alignas(64) float lanePhase1[VoiceKernel::maxWidth];
+    alignas(64) float lanePhase2[VoiceKernel::maxWidth];
+    alignas(64) float lanePhase3[VoiceKernel::maxWidth];
+    alignas(64) int32_t laneWaveOffset1[VoiceKernel::maxWidth];
+    alignas(64) int32_t laneWaveOffset2[VoiceKernel::maxWidth];
+    alignas(64) int32_t laneWaveOffset3[VoiceKernel::maxWidth];
+    alignas(64) int32_t laneWaveMask1[VoiceKernel::maxWidth];
+    alignas(64) int32_t laneWaveMask2[VoiceKernel::maxWidth];
+    alignas(64) int32_t laneWaveMask3[VoiceKernel::maxWidth];
+    alignas(64) float laneWaveScale1[VoiceKernel::maxWidth];
+    alignas(64) float laneWaveScale2[VoiceKernel::maxWidth];
+    alignas(64) float laneWaveScale3[VoiceKernel::maxWidth];
+    alignas(64) float laneBaseRatio1[VoiceKernel::maxWidth];
+    alignas(64) float laneBaseRatio2[VoiceKernel::maxWidth];
+    alignas(64) float laneBaseRatio3[VoiceKernel::maxWidth];
+    alignas(64) float laneNoiseRatio[VoiceKernel::maxWidth];
+    alignas(64) float laneNoisePink[VoiceKernel::maxWidth];
+    std::array<ToneCursor, VoiceKernel::maxWidth> cursors;
+
+    VoiceLaneBlock blk;
+    blk.inc1 = scratch.inc1.data();
+    blk.inc2 = scratch.inc2.data();
+    blk.inc3 = scratch.inc3.data();
+    blk.gain = scratch.gain.data();
+    blk.out = scratch.out.data();
+    blk.phase1 = lanePhase1;
+    blk.phase2 = lanePhase2;
+    blk.phase3 = lanePhase3;
+    blk.waveOffset1 = laneWaveOffset1;
+    blk.waveOffset2 = laneWaveOffset2;
+    blk.waveOffset3 = laneWaveOffset3;
+    blk.waveMask1 = laneWaveMask1;
+    blk.waveMask2 = laneWaveMask2;
+    blk.waveMask3 = laneWaveMask3;
+    blk.waveScale1 = laneWaveScale1;
+    blk.waveScale2 = laneWaveScale2;
+    blk.waveScale3 = laneWaveScale3;
+    blk.baseRatio1 = laneBaseRatio1;
+    blk.baseRatio2 = laneBaseRatio2;
+    blk.baseRatio3 = laneBaseRatio3;
+    blk.noiseRatio = laneNoiseRatio;
+    blk.noisePink = laneNoisePink;
+    blk.waveTable = lut.getWaveMipLUT();
+    blk.lfcTable = lut.getLowFrequencyCorrectionLUT();
+    blk.freqScale = samplingRate / (2.0f * PI);
+
+    for (int32_t i = 0; i < blockSamples; i++) dry[i] = 0.0f;
+    for (int32_t lane = 0; lane < lanes; lane++) {
+        if (useDelay[renderToneIndices[groupTop + lane]] != 0) {
+            float* send = sends + (size_t)lane * (size_t)bufferSamples;
+            for (int32_t i = 0; i < blockSamples; i++) send[i] = 0.0f;
+        }
+    }
+
+    for (int32_t lane = 0; lane < width; lane++) {
+        if (lane < lanes) {
+            const int32_t toneIndex = renderToneIndices[groupTop + lane];
+            const Instrument* instrument = toneInstances[toneIndex].instrument;
+            beginToneCursor(toneIndex, cursors[lane]);
+            lanePhase1[lane] = phase1[toneIndex];
+            lanePhase2[lane] = phase2[toneIndex];
+            lanePhase3[lane] = phase3[toneIndex];
+            laneWaveOffset1[lane] = SharedLUT::getWaveMipOffset(instrument->baseWave1, waveLevel1[toneIndex]);
+            laneWaveOffset2[lane] = SharedLUT::getWaveMipOffset(instrument->baseWave2, waveLevel2[toneIndex]);
+            laneWaveOffset3[lane] = SharedLUT::getWaveMipOffset(instrument->baseWave3, waveLevel3[toneIndex]);
+            laneWaveMask1[lane] = SharedLUT::getWaveMipSize(waveLevel1[toneIndex]) - 1;
+            laneWaveMask2[lane] = SharedLUT::getWaveMipSize(waveLevel2[toneIndex]) - 1;
+            laneWaveMask3[lane] = SharedLUT::getWaveMipSize(waveLevel3[toneIndex]) - 1;
+            laneWaveScale1[lane] = (float)(laneWaveMask1[lane] + 1)/(PI*2.0f);
+            laneWaveScale2[lane] = (float)(laneWaveMask2[lane] + 1)/(PI*2.0f);
+            laneWaveScale3[lane] = (float)(laneWaveMask3[lane] + 1)/(PI*2.0f);
+            laneBaseRatio1[lane] = base1ratio[toneIndex];
+            laneBaseRatio2[lane] = base2ratio[toneIndex];
+            laneBaseRatio3[lane] = base3ratio[toneIndex];
+            laneNoiseRatio[lane] = instrument->noiseRatio;
+            laneNoisePink[lane] = (noiseColorMode[toneIndex] == 1) ? 1.0f : 0.0f;
+        } else {
+            // idle lanes render silence from valid table positions
+            lanePhase1[lane] = lanePhase2[lane] = lanePhase3[lane] = 0.0f;
+            laneWaveOffset1[lane] = laneWaveOffset2[lane] = laneWaveOffset3[lane] = 0;
+            laneWaveMask1[lane] = laneWaveMask2[lane] = laneWaveMask3[lane] = 0;
+            laneWaveScale1[lane] = laneWaveScale2[lane] = laneWaveScale3[lane] = 0.0f;
+            laneBaseRatio1[lane] = laneBaseRatio2[lane] = laneBaseRatio3[lane] = 0.0f;
+            laneNoiseRatio[lane] = laneNoisePink[lane] = 0.0f;
+        }
+    }
+
+    for (int32_t offset = 0; offset < blockSamples; offset += laneBlockSamples) {
+        const int32_t count = std::min(laneBlockSamples, blockSamples - offset);
+        for (int32_t lane = 0; lane < width; lane++) {
+            if (lane < lanes) {
+                renderToneControl(renderToneIndices[groupTop + lane], cursors[lane], scratch, offset, count, lane, width, noiseBufIndex);
+            } else {
+                for (int32_t i = 0; i < count; i++) {
+                    scratch.inc1[i*width+lane] = scratch.inc2[i*width+lane] = scratch.inc3[i*width+lane] = 0.0f;
+                    scratch.gain[i*width+lane] = 0.0f;
+                }
+            }
+        }
+        blk.numSamples = count;
+        blk.whiteNoise = lut.getWhiteNoiseLUT() + noiseBufIndex + offset;
+        blk.pinkNoise = lut.getPinkNoiseLUT() + noiseBufIndex + offset;
+        voiceKernel->render(blk);
+        for (int32_t lane = 0; lane < lanes; lane++) {
+            if (useDelay[renderToneIndices[groupTop + lane]] != 0) {
+                sendToneToDelay(cursors[lane], scratch, lane, width, sends + (size_t)lane * (size_t)bufferSamples + offset);
+            }
+        }
+        voiceKernel->mix(scratch.out.data(), count, dry + offset);
+    }
+
+    for (int32_t lane = 0; lane < lanes; lane++) {
+        const int32_t toneIndex = renderToneIndices[groupTop + lane];
+        phase1[toneIndex] = lanePhase1[lane];
+        phase2[toneIndex] = lanePhase2[lane];
+        phase3[toneIndex] = lanePhase3[lane];
+        toneEnded[toneIndex] = cursors[lane].isEnd ? 1 : 0;
+    }
+}
+
+
+// Per-buffer state of one tone in the lane path.
+void Sequencer::beginToneCursor(int32_t toneIndex, ToneCursor &cursor){
+    const Instrument* instrument = toneInstances[toneIndex].instrument;
+    const auto& lut = SharedLUT::getInstance();
+    cursor.current = (float)passed[toneIndex];
+    cursor.releaseStart = waitDuration[toneIndex] + mainteinDuration[toneIndex];
+    cursor.releaseEnd = cursor.releaseStart + releaseTime[toneIndex];
+    cursor.attackEnd = waitDuration[toneIndex] + instrument->atackSlopeTime;
+    cursor.isEnd = false;
+    cursor.toneBegin = cursor.toneEnd = 0;
+    cursor.freqNoiseLUT = (freqNoiseMode[toneIndex] == 1) ? lut.getTriangularDistributionLUT()
+                        : (freqNoiseMode[toneIndex] == 2) ? lut.getCos4thPowDistributionLUT()
+                        : lut.getWhiteNoiseLUT();
+    cursor.fmWave = static_cast<int32_t>(instrument->fmWave);
+    cursor.fmWaveInvert = 1.0f;
+    if (instrument->fmWave == BaseWave::WAVE_SINSAWx2){
+        cursor.fmWave = static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH);
+        cursor.fmWaveInvert = -1.0f;
+    }
+    cursor.amWave = static_cast<int32_t>(instrument->amWave);
+    cursor.amWaveInvert = 1.0f;
+    if (instrument->amWave == BaseWave::WAVE_SINSAWx2){
+        cursor.amWave = static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH);
+        cursor.amWaveInvert = -1.0f;
+    }
+}
+
+
+// Scalar control stage of the lane path: envelope, frequency noise, FM and AM
+// for 'count' samples of one tone, written to column 'lane' of the lane buffers.
+// Samples where the tone is silent get zero increment and zero gain.
+//
+// With controlRate > 1 the control signals are evaluated once per control step
+// (at its last sample) and the gain and pitch ratio are ramped linearly from
+// the previous step, so only the ramps run at audio rate.
+void Sequencer::renderToneControl(int32_t toneIndex, ToneCursor &cursor, LaneScratch &scratch, int32_t offset, int32_t count, int32_t lane, int32_t width, int32_t noiseBufIndex){
+    float* inc1Out = scratch.inc1.data() + lane;
+    float* inc2Out = scratch.inc2.data() + lane;
+    float* inc3Out = scratch.inc3.data() + lane;
+    float* gainOut = scratch.gain.data() + lane;
+    cursor.toneBegin = cursor.toneEnd = 0;
+    if (cursor.isEnd) {
+        for (int32_t i = 0; i < count; i++) {
+            inc1Out[i*width] = inc2Out[i*width] = inc3Out[i*width] = gainOut[i*width] = 0.0f;
+        }
+        return;
+    }
+
+    auto& lut = SharedLUT::getInstance();
+    const auto& waveLUT = lut.getWaveLUT();
+    const float phaseToIndex = (float)SharedLUT::getWaveLUTSize()/(PI*2.0f);
+    const float delta = (1.0f / samplingRate) * 1000.0f;
+    const float div = 1.0f/asumedConcurrentTone; // to avoid saturation.
+    const Instrument* instrument = toneInstances[toneIndex].instrument;
+    const float sustainRate = instrument->sustainRate;
+    const float fmCentRange = instrument->fmCentRange;
+    const float amLevel = instrument->amLevel;
+    const float totalGain = instrument->totalGain;
+    const bool doFM = (useFM[toneIndex] != 0);
+    const bool doAM = (useAM[toneIndex] != 0);
+    const bool doFreqNoise = (useFreqNoise[toneIndex] != 0);
+    const bool doPitch = doFM || doFreqNoise;
+    const float* freqNoiseLUT = cursor.freqNoiseLUT + noiseBufIndex + offset;
+
+    float& st = strength[toneIndex];
+    float& atkSt = atackedStrength[toneIndex];
+    float& decSt = decayedStrength[toneIndex];
+    float& atkFloor = atackedStrengthfloor[toneIndex];
+    float& fmPh = fmPhase[toneIndex];
+    float& amPh = amPhase[toneIndex];
+    float& wt = waitDuration[toneIndex];
+    float& rw = restartWaitDuration[toneIndex];
+    float& md = mainteinDuration[toneIndex];
+
+    // Control signals at time 'now', 'steps' samples after the previous
+    // evaluation. Returns false when the tone is silent; sets cursor.isEnd when
+    // it is over.
+    auto evaluate = [&](float now, float steps, int32_t noiseIndex, float &gain, float &cent) {
+        bool isTone = false;
+        if (now > rw) {
+            toneInstances[toneIndex].note.state = NState::NS_ON_FOREVER;
+            md = rw = FLOAT_LONGTIME;
+            atkFloor = st;
+            wt = now;
+            tempo_f[toneIndex] = restartTempo_f[toneIndex];
+            velocity_f[toneIndex] = restartVelocity_f[toneIndex];
+        }
+        if (now > cursor.releaseEnd){
+            cursor.isEnd = true;
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            if (logLevel > 1){
+                gdsynth::print(
+                        "[envelope] tone ended: idx=", toneIndex,
+                        " ch=", toneInstances[toneIndex].note.channel,
+                        " key=", toneInstances[toneIndex].note.key,
+                        " prog=", toneInstances[toneIndex].note.program,
+                        " current(ms)=", now,
+                        " releaseEnd(ms)=", cursor.releaseEnd
+                );
+            }
+#endif // DEBUG_ENABLED
+            return false;
+        }
+        else if (now > cursor.releaseStart){ // release
+            int32_t d = (int32_t)(((now-(wt+md))*releaseSlopeRatio[toneIndex])/delta);
+            if (d >= lut.getNumReleaseSlopeLUT()) d = lut.getNumReleaseSlopeLUT() - 1;
+            atkFloor = st = decSt*lut.getReleaseSlopeLUT()[d];
+            isTone = true;
+        }
+        else if (now > cursor.attackEnd){ // decay and sustain
+            int32_t d = (int32_t)(((now-cursor.attackEnd)*decaySlopeRatio[toneIndex])/delta);
+            if (d >= lut.getNumDecaySlopeLUT()) d = lut.getNumDecaySlopeLUT() - 1;
+            st = atkSt*((lut.getDecaySlopeLUT()[d]*(1.0f-sustainRate)+sustainRate));
+            atkFloor = decSt = st;
+            isTone = true;
+        }
+        else if (now > wt){ // atack
+            int32_t d = (int32_t)((now-wt)*atackSlopeRatio[toneIndex]/delta);
+            if (d >= lut.getNumAtackSlopeLUT()) d = lut.getNumAtackSlopeLUT() - 1;
+            st = lut.getAtackSlopeLUT()[d]*(1.0f-atkFloor)+atkFloor;
+            decSt = atkSt = st;
+            isTone = true;
+        }
+        if (!isTone) return false;
+
+        cent = 0.0f;
+        if (doFreqNoise) {
+            cent = freqNoiseCentharfRange[toneIndex]*freqNoiseLUT[noiseIndex];
+        }
+        if (doFM && now > wt){
+            fmPh += fmIncrement[toneIndex]*steps;
+            while (fmPh > PI*2.0f) fmPh -= PI*2.0f;
+            int32_t fmIdx = (int32_t)(fmPh * phaseToIndex) & 0x0FFF; // Clamp to waveLUTSize-1 (4095)
+            cent += fmCentRange*(waveLUT[cursor.fmWave][fmIdx]*cursor.fmWaveInvert+1.0f)*0.5f;
+        }
+        float level = 1.0f;
+        if (doAM && now > wt){
+            amPh += amIncrement[toneIndex]*steps;
+            while (amPh > PI*2.0f) amPh -= PI*2.0f;
+            int32_t amIdx = (int32_t)(amPh * phaseToIndex) & 0x0FFF; // Clamp to waveLUTSize-1 (4095)
+            level = (amLevel)*(waveLUT[cursor.amWave][amIdx]*cursor.amWaveInvert+1.0f)*0.5f;
+            level += 1.0f - amLevel;
+        }
+        gain = (velocity_f[toneIndex]*st*div*level)*totalGain;
+        return true;
+    };
+
+    float ratioBlock[laneBlockSamples];
+    float soundingBlock[laneBlockSamples];
+    float current = cursor.current;
+    int32_t toneBegin = -1;
+    int32_t toneEnd = 0;
+    int32_t i = 0;
+    if (controlRate == 1) {
+        float envBlock[laneBlockSamples];
+        i = renderToneEnvelope(toneIndex, cursor, count, envBlock, soundingBlock, toneBegin, toneEnd);
+        current = cursor.current;
+
+        // LFOs and frequency noise, masked to the sounding samples
+        float levelBlock[laneBlockSamples];
+        float centBlock[laneBlockSamples];
+        for (int32_t k = 0; k < i; k++) {
+            levelBlock[k] = 1.0f;
+            centBlock[k] = 0.0f;
+        }
+        if (doFreqNoise) {
+            const float halfRange = freqNoiseCentharfRange[toneIndex];
+            for (int32_t k = 0; k < i; k++) {
+                centBlock[k] = halfRange*freqNoiseLUT[k];
+            }
+        }
+        if (doFM) {
+            const float fmInc = fmIncrement[toneIndex];
+            for (int32_t k = 0; k < i; k++) {
+                fmPh += fmInc*soundingBlock[k];
+                fmPh = (fmPh > PI*2.0f) ? fmPh - PI*2.0f : fmPh;
+                int32_t fmIdx = (int32_t)(fmPh * phaseToIndex) & 0x0FFF; // Clamp to waveLUTSize-1 (4095)
+                centBlock[k] += fmCentRange*(waveLUT[cursor.fmWave][fmIdx]*cursor.fmWaveInvert+1.0f)*0.5f;
+            }
+        }
+        if (doAM) {
+            const float amInc = amIncrement[toneIndex];
+            for (int32_t k = 0; k < i; k++) {
+                amPh += amInc*soundingBlock[k];
+                amPh = (amPh > PI*2.0f) ? amPh - PI*2.0f : amPh;
+                int32_t amIdx = (int32_t)(amPh * phaseToIndex) & 0x0FFF; // Clamp to waveLUTSize-1 (4095)
+                levelBlock[k] = (amLevel)*(waveLUT[cursor.amWave][amIdx]*cursor.amWaveInvert+1.0f)*0.5f + (1.0f - amLevel);
+            }
+        }
+        for (int32_t k = 0; k < i; k++) {
+            gainOut[k*width] = (envBlock[k]*div*levelBlock[k])*totalGain*soundingBlock[k];
+            scratch.sounding[k*width + lane] = (soundingBlock[k] != 0.0f) ? 1 : 0;
+        }
+        if (doPitch) centToRatioBlock(centBlock, ratioBlock, i);
+    } else {
+        float& gainFrom = controlGain[toneIndex];
+        float& ratioFrom = controlRatio[toneIndex];
+        while (i < count) {
+            const int32_t steps = std::min(controlRate, count - i);
+            const float startTime = wt; // the note may start inside this step
+            float gain = 0.0f;
+            float cent = 0.0f;
+            const bool isTone = evaluate(current + delta*(float)(steps - 1), (float)steps, i + steps - 1, gain, cent);
+            if (cursor.isEnd) break;
+            const float ratio = doPitch ? centToRatio(cent) : 1.0f;
+            const float invSteps = 1.0f / (float)steps;
+            const float gainStep = (gain - gainFrom) * invSteps;
+            const float ratioStep = (ratio - ratioFrom) * invSteps;
+            for (int32_t k = 1; k <= steps; k++, i++) {
+                const int32_t row = i * width;
+                const bool sampleIsTone = isTone && (current > startTime);
+                gainOut[row] = sampleIsTone ? gainFrom + gainStep*(float)k : 0.0f;
+                ratioBlock[i] = ratioFrom + ratioStep*(float)k;
+                soundingBlock[i] = sampleIsTone ? 1.0f : 0.0f;
+                scratch.sounding[row + lane] = sampleIsTone ? 1 : 0;
+                if (sampleIsTone) {
+                    if (toneBegin < 0) toneBegin = i;
+                    toneEnd = i + 1;
+                }
+                current += delta;
+            }
+            gainFrom = gain;
+            ratioFrom = ratio;
+        }
+    }
+    const int32_t sounding = i;
+    for (; i < count; i++) {
+        gainOut[i*width] = 0.0f;
+        scratch.sounding[i*width + lane] = 0;
+        soundingBlock[i] = 0.0f;
+    }
+
+    // pitch: silent samples get a zero increment so the phases hold
+    const float base1 = baseIncrement1[toneIndex];
+    const float base2 = baseIncrement2[toneIndex];
+    const float base3 = baseIncrement3[toneIndex];
+    if (doPitch) {
+        for (i = 0; i < sounding; i++) {
+            inc1Out[i*width] = std::min(base1*ratioBlock[i], maxIncrement)*soundingBlock[i];
+            inc2Out[i*width] = std::min(base2*ratioBlock[i], maxIncrement)*soundingBlock[i];
+            inc3Out[i*width] = std::min(base3*ratioBlock[i], maxIncrement)*soundingBlock[i];
+        }
+    }
+    else {
+        for (i = 0; i < sounding; i++) {
+            inc1Out[i*width] = base1*soundingBlock[i];
+            inc2Out[i*width] = base2*soundingBlock[i];
+            inc3Out[i*width] = base3*soundingBlock[i];
+        }
+    }
+    for (; i < count; i++) {
+        inc1Out[i*width] = inc2Out[i*width] = inc3Out[i*width] = 0.0f;
+    }
+    cursor.current = current;
+    cursor.toneBegin = (toneBegin < 0) ? 0 : toneBegin;
+    cursor.toneEnd = toneEnd;
+}
+
+
+// Envelope of one tone for 'count' samples, segment by segment.
+//
+// The block is split at the sample indices where the tone starts, where
+// attack, decay/sustain and release begin, where it restarts and where it
+// ends; each segment then runs a branch-free loop stepping its slope LUT
+// index by the tone's slope ratio per sample. Writes velocity * strength to
+// env and 1/0 to sounding, returns the number of samples before the end of the
+// tone (count when it does not end in this block).
+int32_t Sequencer::renderToneEnvelope(int32_t toneIndex, ToneCursor &cursor, int32_t count, float *env, float *sounding, int32_t &toneBegin, int32_t &toneEnd){
+    const auto& lut = SharedLUT::getInstance();
+    const Instrument* instrument = toneInstances[toneIndex].instrument;
+    const float sustainRate = instrument->sustainRate;
+    const float delta = (1.0f / samplingRate) * 1000.0f;
+    const float invDelta = 1.0f / delta;
+    const float* atackLUT = lut.getAtackSlopeLUT();
+    const float* decayLUT = lut.getDecaySlopeLUT();
+    const float* releaseLUT = lut.getReleaseSlopeLUT();
+    const int32_t atackLast = lut.getNumAtackSlopeLUT() - 1;
+    const int32_t decayLast = lut.getNumDecaySlopeLUT() - 1;
+    const int32_t releaseLast = lut.getNumReleaseSlopeLUT() - 1;
+    const float atackRatio = atackSlopeRatio[toneIndex];
+    const float decayRatio = decaySlopeRatio[toneIndex];
+    const float releaseRatio = releaseSlopeRatio[toneIndex];
+    float& st = strength[toneIndex];
+    float& atkSt = atackedStrength[toneIndex];
+    float& decSt = decayedStrength[toneIndex];
+    float& atkFloor = atackedStrengthfloor[toneIndex];
+    float& wt = waitDuration[toneIndex];
+    float& rw = restartWaitDuration[toneIndex];
+    float& md = mainteinDuration[toneIndex];
+
+    float current = cursor.current; // time of sample i
+    int32_t i = 0;
+    while (i < count) {
+        // first sample from i whose time is past 'boundary'
+        auto firstAfter = [&](float boundary) {
+            const float samples = std::clamp((boundary - current) * invDelta + 1.0f, 0.0f, (float)(count - i));
+            return i + (int32_t)samples;
+        };
+        const int32_t restartAt = firstAfter(rw);
+        const int32_t endAt = firstAfter(cursor.releaseEnd);
+        const int32_t limit = std::min(restartAt, endAt);
+        const int32_t atackBegin = std::min(firstAfter(wt), limit);
+        const int32_t releaseBegin = std::max(std::min(firstAfter(cursor.releaseStart), limit), atackBegin);
+        const int32_t decayBegin = std::max(std::min(firstAfter(cursor.attackEnd), releaseBegin), atackBegin);
+
+        int32_t k = i;
+        for (; k < atackBegin; k++) {
+            env[k] = 0.0f;
+            sounding[k] = 0.0f;
+        }
+        const float velF = velocity_f[toneIndex];
+        if (k < decayBegin) { // atack
+            float x = (current + (float)(k - i)*delta - wt)*atackRatio*invDelta;
+            const float floor = atkFloor;
+            for (; k < decayBegin; k++, x += atackRatio) {
+                st = atackLUT[std::min((int32_t)x, atackLast)]*(1.0f-floor)+floor;
+                env[k] = velF*st;
+                sounding[k] = 1.0f;
+            }
+            decSt = atkSt = st;
+        }
+        if (k < releaseBegin) { // decay and sustain
+            float x = (current + (float)(k - i)*delta - cursor.attackEnd)*decayRatio*invDelta;
+            const float peak = atkSt;
+            for (; k < releaseBegin; k++, x += decayRatio) {
+                st = peak*((decayLUT[std::min((int32_t)x, decayLast)]*(1.0f-sustainRate)+sustainRate));
+                env[k] = velF*st;
+                sounding[k] = 1.0f;
+            }
+            atkFloor = decSt = st;
+        }
+        if (k < limit) { // release
+            float x = (current + (float)(k - i)*delta - (wt+md))*releaseRatio*invDelta;
+            const float from = decSt;
+            for (; k < limit; k++, x += releaseRatio) {
+                st = from*releaseLUT[std::min((int32_t)x, releaseLast)];
+                env[k] = velF*st;
+                sounding[k] = 1.0f;
+            }
+            atkFloor = st;
+        }
+        if (atackBegin < limit) {
+            if (toneBegin < 0) toneBegin = atackBegin;
+            toneEnd = limit;
+        }
+        current += (float)(limit - i)*delta;
+        i = limit;
+
+        if (i == endAt && i < count) {
+            cursor.isEnd = true;
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+            if (logLevel > 1){
+                gdsynth::print(
+                        "[envelope] tone ended: idx=", toneIndex,
+                        " ch=", toneInstances[toneIndex].note.channel,
+                        " key=", toneInstances[toneIndex].note.key,
+                        " prog=", toneInstances[toneIndex].note.program,
+                        " current(ms)=", current,
+                        " releaseEnd(ms)=", cursor.releaseEnd
+                );
+            }
+#endif // DEBUG_ENABLED
+            break;
+        }
+        if (i == restartAt && i < count) {
+            toneInstances[toneIndex].note.state = NState::NS_ON_FOREVER;
+            md = rw = FLOAT_LONGTIME;
+            atkFloor = st;
+            wt = current;
+            tempo_f[toneIndex] = restartTempo_f[toneIndex];
+            velocity_f[toneIndex] = restartVelocity_f[toneIndex];
+            cursor.releaseStart = wt + md;
+            cursor.releaseEnd = cursor.releaseStart + releaseTime[toneIndex];
+            cursor.attackEnd = wt + instrument->atackSlopeTime;
+        }
+    }
+    cursor.current = current;
+    return i;
+}
+
+
+// Moves column 'lane' of the kernel output into the tone's send buffer, which
+// renderTonesLanes() adds to the input of its delay line.
+void Sequencer::sendToneToDelay(const ToneCursor &cursor, LaneScratch &scratch, int32_t lane, int32_t width, float *send){
+    float* out = scratch.out.data() + lane;
+    for (int32_t i = cursor.toneBegin; i < cursor.toneEnd; i++) {
+        send[i] = out[i*width];
+        out[i*width] = 0.0f;
+    }
+}
+
+
+// Adds delayLineChunk lines with rings from one more calloc'ed block. delayLines and
+// delayLineInput were reserved for maxDelayLines, so neither moves.
+bool Sequencer::growDelayLines(void){
+    const int32_t first = (int32_t)delayLines.size();
+    const int32_t count = std::min(delayLineChunk, maxDelayLines - first);
+    if (count <= 0) {
+        return false;
+    }
+    float* rings = static_cast<float*>(std::calloc((size_t)count * (size_t)delayBufferSize, sizeof(float)));
+    if (!rings) {
+        return false;
+    }
+    delayLineChunks.emplace_back(rings, &std::free);
+    for (int32_t i = 0; i < count; i++) {
+        DelayLine line;
+        line.ring = rings + (size_t)i * (size_t)delayBufferSize;
+        delayLines.push_back(line);
+    }
+    delayLineInput.resize(delayLines.size() * (size_t)bufferSamples, 0.0f);
+    return true;
+}
+
+
+// Claims the delay line of an instrument: the bus of its program, or a line of its own
+// when delayPerVoice is set. Returns -1 when the instrument has no delay or no line can be added.
+int32_t Sequencer::acquireDelayLine(const Patch &patch, int32_t programNum){
+    if (!patch.delay.enabled) {
+        return -1;
+    }
+    const bool shared = (patch.delayPerVoice == 0 && programNum >= 0 && programNum < numinstruments);
+    int32_t index = shared ? delayBusOfProgram[programNum] : -1;
+    if (index < 0) {
+        const int32_t numLines = (int32_t)delayLines.size();
+        for (int32_t i = 0; i < numLines; i++) {
+            if (!delayLines[i].inUse) {
+                index = i;
+                break;
+            }
+        }
+        if (index < 0) {
+            if (!growDelayLines()) {
+                return -1;
+            }
+            index = numLines;
+        }
+        DelayLine& fresh = delayLines[index];
+        fresh.inUse = true;
+        fresh.needsClear = true;
+        fresh.hasInput = false;
+        fresh.cursor = 0;
+        fresh.program = shared ? programNum : -1;
+        if (shared) {
+            delayBusOfProgram[programNum] = index;
+        }
+    }
+
+    // the bus follows the latest note-on of its program
+    DelayLine& line = delayLines[index];
+    if (line.taps.mask != patch.delay.mask) {
+        line.cursor = 0;
+        line.needsClear = true;
+    }
+    line.taps = patch.delay;
+    line.tailLeft = line.taps.tailSamples;
+    line.quietSamples = 0;
+    return index;
+}
+
+
+// Three tap delay of every line in use, mixed into the frame. A line is released once
+// its input has been silent for the length of its tail.
+bool Sequencer::renderDelayLines(float *frame){
+    bool running = false;
+    const int32_t numLines = (int32_t)delayLines.size();
+    for (int32_t l = 0; l < numLines; l++) {
+        DelayLine& line = delayLines[l];
+        if (!line.inUse) continue;
+        float* ring = line.ring;
+        float* input = delayLineInput.data() + (size_t)l * (size_t)bufferSamples;
+        if (line.needsClear) {
+            std::memset(ring, 0, sizeof(float) * (size_t)(line.taps.mask + 1));
+            line.needsClear = false;
+        }
+        const int32_t mask = line.taps.mask;
+        int32_t c = line.cursor;
+        float peak = 0.0f;
+        for (int32_t i = 0; i < blockSamples; i++) {
+            const float data = input[i] * line.taps.mainRatio + ring[c];
+            float& d0 = ring[(c + line.taps.tap0) & mask];
+            d0 = std::clamp(d0 + data * line.taps.ratio0, -1.0f, 1.0f);
+            float& d1 = ring[(c + line.taps.tap1) & mask];
+            d1 = std::clamp(d1 + data * line.taps.ratio1, -1.0f, 1.0f);
+            float& d2 = ring[(c + line.taps.tap2) & mask];
+            d2 = std::clamp(d2 + data * line.taps.ratio2, -1.0f, 1.0f);
+            ring[c] = 0.0f;
+            c = (c + 1) & mask;
+            frame[i] += data;
+            input[i] = 0.0f;
+            peak = std::max(peak, std::fabs(data));
+        }
+        line.cursor = c;
+
+        if (line.hasInput) {
+            line.tailLeft = line.taps.tailSamples;
+            line.quietSamples = 0;
+        } else {
+            line.tailLeft -= blockSamples;
+            line.quietSamples = (peak < cullGain) ? line.quietSamples + blockSamples : 0;
+            // after a whole ring of quiet output the ring holds nothing louder
+            if (line.quietSamples > mask && line.tailLeft > 0) {
+                cullStats.skippedDelaySamples += line.tailLeft;
+                line.tailLeft = 0;
+            }
+        }
+        line.hasInput = false;
+        if (line.tailLeft <= 0) {
+            line.inUse = false;
+            if (line.program >= 0) {
+                delayBusOfProgram[line.program] = -1;
+            }
+            continue;
+        }
+        running = true;
+    }
+    return running;
+}
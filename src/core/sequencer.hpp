@@ -0,0 +1,752 @@
+/**************************************************************************/
+/*  sequencer.hpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+#include <cmath>
+#include <cstdlib>
+#include "smfparser.hpp"
+#include "voice_kernel.hpp"
+#include "worker_pool.hpp"
+#include "mpsc_queue.hpp"
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <functional>
+#include <memory>
+#include <tuple>
+
+#define PI 3.1415926535897932384626433833f
+#define FLOAT_LONGTIME 36000000.0f
+
+enum class BaseWave {
+    WAVE_SIN,         //  0
+    WAVE_SQUARE,      //  1
+    WAVE_TRIANGLE,    //  2
+    WAVE_SAWTOOTH,    //  3
+    WAVE_SINSAWx2,    //  4
+
+    WAVE_TAIL
+};
+
+
+enum class NoiseDistributType {
+    NOISEDTYPE_FLAT,       //  0
+    NOISEDTYPE_TRIANGULAR, //  1
+    NOISEDTYPE_COS4ThPOW,  //  2
+
+    NOISEDTYPE_TAIL
+};
+
+enum class NoiseColorType {
+    NOISECTYPE_WHITE,   //  0
+    NOISECTYPE_PINK,    //  1
+
+    NOISECTYPE_TAIL
+};
+
+struct Instrument{
+    float totalGain;
+    
+    float atackSlopeTime;
+    float decayHalfLifeTime;
+    float sustainRate;
+    float releaseSlopeTime;
+
+    float baseVsOthersRatio;
+    float side1VsSide2Ratio;
+
+    float baseOffsetCent1;
+    BaseWave baseWave1;
+    float baseOffsetCent2;
+    BaseWave baseWave2;
+    float baseOffsetCent3;
+    BaseWave baseWave3;
+
+    float noiseRatio;
+    NoiseColorType noiseColorType;
+    
+    float delay0Time;
+    float delay1Time;
+    float delay2Time;
+    float delay0Ratio;
+    float delay1Ratio;
+    float delay2Ratio;
+    
+    float freqNoiseCentRange;
+    NoiseDistributType freqNoiseType;
+    
+    float fmCentRange;
+    float fmFreq;
+    float fmPhaseOffset;
+    int32_t fmSync;
+    BaseWave fmWave;
+
+    float amLevel;
+    float amFreq;
+    float amPhaseOffset;
+    int32_t amSync;
+    BaseWave amWave;
+
+    int32_t delayPerVoice; // 1: the delay runs per voice instead of on the program's shared bus
+};
+
+struct Percussion{
+    int32_t program;
+    int32_t key;
+};
+
+// Control params shared by the GDExtension dictionary and headless callers.
+struct ControlParams {
+    float divisionNum = 4.0f;   // assumed number of concurrent tones
+    int32_t logLevel = 1;
+    float preOnTime = 0.0f;     // pre-on signal time in milliseconds (0 = disabled)
+    RenderKernel renderKernel = RenderKernel::RK_AUTO; // voice rendering path
+    float masterKnee = 1.0f;    // master limiter: 1.0 = hard clip, below = soft knee level
+    int32_t controlRate = 1;    // samples per envelope/LFO/freq noise evaluation: 1, 2, 4 ... 32 (lane kernels only)
+    int32_t renderThreads = 1;  // threads rendering voices, the caller included (lane kernels only)
+    float cullLevel = -100.0f;  // dB: decayed voices and delay tails below it stop rendering, -200 = never
+};
+
+// Totals of the audibility culling since initParam().
+struct CullStats {
+    int64_t renderedVoiceSamples = 0;
+    int64_t skippedVoiceSamples = 0;  // of silent held voices, and the rest of the releases cut short
+    int64_t skippedDelaySamples = 0;  // the rest of the delay tails cut short
+    int64_t culledVoices = 0;
+};
+
+// Live input event, queued by any thread and applied by feed() at its sample.
+enum class LiveEventType : int32_t {
+    LE_NOTE_ON,
+    LE_NOTE_OFF,
+    LE_CHANNEL_PRIORITY,    // note.channel, value: priority
+};
+
+struct LiveEvent {
+    LiveEventType type = LiveEventType::LE_NOTE_ON;
+    Note note{};
+    int32_t value = 0;
+    int64_t sampleTime = 0;         // on the sample clock, see Sequencer::getSampleClock()
+};
+
+// Totals of the live input since initParam().
+struct LiveInputStats {
+    int64_t applied = 0;
+    int64_t late = 0;               // stamped before the block that took them, played at its start
+    int64_t dropped = 0;            // refused by a full queue
+};
+
+// Event emitted from feed(). The binding layer converts it into a signal.
+struct EmittedEvent {
+    int32_t msg = 0; // 0: note on/off, 1: level info, 2: pre-on/pre-off signal
+    struct NotePayload {
+        int32_t onOff = 0;
+        int32_t trackNum = 0;
+        int32_t channel = 0;
+        int32_t velocity = 0;
+        int32_t program = 0;
+        int32_t key = 0;
+        int32_t instrumentNum = 0;
+        int32_t key2 = 0;
+    } note;
+    struct LevelPayload {
+        int32_t max_level = 0;
+        int32_t frame_level = 0;
+        int32_t rendered_samples = 0; // voice-samples rendered in the buffer
+        int32_t skipped_samples = 0;  // voice-samples skipped by culling in the buffer
+    } level;
+};
+
+class PinkNoise {
+private:
+    static constexpr int32_t tapNum  = 16;
+    float z[tapNum];
+    float k[tapNum];
+    float t = 0.0;
+public:
+    PinkNoise();
+    ~PinkNoise();
+    float makeNoise (float);    
+};
+
+// Shared LUT manager for all Sequencer instances (Singleton pattern)
+class SharedLUT {
+private:
+    static constexpr int32_t waveLUTSize = 4096;
+    static constexpr int32_t pow2_x_1200LUT_size = 7200;
+    static constexpr int32_t lowFrequencyCorrectionLUT_size = 8192;
+    
+    // Sequencers using the tables, guarded by refMutex like initialize()
+    int32_t refCount = 0;
+    std::mutex refMutex;
+    
+    // Band-limited wave mipmaps: one level per octave of phase increment.
+    // Level 0 holds waveMipTopHarmonics harmonics and each next level half as
+    // many, so a voice playing at or below getWaveMipLimit(level) never aliases.
+    // A level has 4 entries per harmonic, at least waveMipMinSize, plus a copy
+    // of entry 0 at the end for the interpolation.
+    static constexpr int32_t waveMipLevels = 11;
+    static constexpr int32_t waveMipTopHarmonics = 1024;
+    static constexpr int32_t waveMipMinSize = 1024;
+    static constexpr int32_t waveMipSize(int32_t level) {
+        return std::max((waveMipTopHarmonics * 4) >> level, waveMipMinSize);
+    }
+    static constexpr int32_t waveMipStride() {
+        int32_t stride = 0;
+        for (int32_t level = 0; level < waveMipLevels; level++) stride += waveMipSize(level) + 1;
+        return stride;
+    }
+
+    // Rate independent LUTs, computed at compile time (see lut_math.hpp)
+    static const std::array<std::array<float, waveLUTSize>, static_cast<int32_t>(BaseWave::WAVE_TAIL)> waveLUT; // naive shapes for LFOs
+    static const std::array<float, pow2_x_1200LUT_size> pow2_x_1200LUT;
+    static const std::array<float, 128> velocity2powerLUT;
+    static const std::array<float, lowFrequencyCorrectionLUT_size> lowFrequencyCorrectionLUT;
+
+    // Built once, with the first rate dependent tables
+    std::unique_ptr<float[]> waveMipLUT;
+    
+    // Slope LUTs (shared, but size depends on sampling rate)
+    std::unique_ptr<float[]> atackSlopeLUT;
+    std::unique_ptr<float[]> releaseSlopeLUT;
+    std::unique_ptr<float[]> decaySlopeLUT;
+    int32_t numAtackSlopeLUT;
+    int32_t numReleaseSlopeLUT;
+    int32_t numDecaySlopeLUT;
+    float atackSlopeTime;
+    float releaseSlopeTime;
+    float decaySlopeTime;
+    float atackSlopeHz;
+    float releaseSlopeHz;
+    float decaySlopeHz;
+    float decayHalfLifeTime;
+    float samplingRate; // Last used sampling rate
+    
+    // Noise LUTs (shared, but size depends on buffer size)
+    std::unique_ptr<float[]> whiteNoiseLUT;
+    std::unique_ptr<float[]> pinkNoiseLUT;
+    std::unique_ptr<float[]> triangularDistributionLUT;
+    std::unique_ptr<float[]> cos4thPowDistributionLUT;
+    int32_t noiseBufferSize;
+    int32_t noiseGuardSize;    // entries past noiseBufferSize repeating the head
+    
+    // The rate dependent tables and the wave mipmaps are built on a worker
+    // thread started by initialize(); waitReady() joins it.
+    std::future<void> pendingBuild;
+    std::mutex buildMutex;
+    std::atomic<bool> tablesReady;
+    void buildTables(bool buildWaveMip);
+    
+    // Private constructor (Singleton pattern); the instance lives until exit
+    SharedLUT();
+    ~SharedLUT() = default;
+    
+    // Prevent copying
+    SharedLUT(const SharedLUT&) = delete;
+    SharedLUT& operator=(const SharedLUT&) = delete;
+    
+public:
+    // Get singleton instance (thread-safe)
+    static SharedLUT& getInstance();
+    
+    // Initialize shared LUTs. Returns before the rate dependent tables are
+    // built; call waitReady() before reading them. The noise tables get
+    // noiseGuard extra entries so a block may start anywhere in the period.
+    bool initialize(float rate, int32_t noiseBufSize, int32_t noiseGuard = 0);
+    
+    // Blocks until the tables started by initialize() are built
+    void waitReady();
+    
+    // Cleanup shared LUTs (called when last instance is destroyed)
+    void cleanup();
+    
+    // Increment reference count
+    void addRef();
+    
+    // Decrement reference count and release the tables after the last one
+    void removeRef();
+    
+    // Accessors for LUTs
+    const std::array<std::array<float, waveLUTSize>, static_cast<int32_t>(BaseWave::WAVE_TAIL)>& getWaveLUT() const { return waveLUT; }
+    const float* getWaveMipLUT() const { return waveMipLUT.get(); }
+    const float* getAtackSlopeLUT() const { return atackSlopeLUT.get(); }
+    const float* getReleaseSlopeLUT() const { return releaseSlopeLUT.get(); }
+    const float* getDecaySlopeLUT() const { return decaySlopeLUT.get(); }
+    const float* getWhiteNoiseLUT() const { return whiteNoiseLUT.get(); }
+    const float* getPinkNoiseLUT() const { return pinkNoiseLUT.get(); }
+    const float* getTriangularDistributionLUT() const { return triangularDistributionLUT.get(); }
+    const float* getCos4thPowDistributionLUT() const { return cos4thPowDistributionLUT.get(); }
+    const float* getPow2_x_1200LUT() const { return pow2_x_1200LUT.data(); }
+    const float* getVelocity2powerLUT() const { return velocity2powerLUT.data(); }
+    const float* getLowFrequencyCorrectionLUT() const { return lowFrequencyCorrectionLUT.data(); }
+    
+    int32_t getNumAtackSlopeLUT() const { return numAtackSlopeLUT; }
+    int32_t getNumReleaseSlopeLUT() const { return numReleaseSlopeLUT; }
+    int32_t getNumDecaySlopeLUT() const { return numDecaySlopeLUT; }
+    float getAtackSlopeTime() const { return atackSlopeTime; }
+    float getReleaseSlopeTime() const { return releaseSlopeTime; }
+    float getDecaySlopeTime() const { return decaySlopeTime; }
+    float getDecayHalfLifeTime() const { return decayHalfLifeTime; }
+    
+    static constexpr int32_t getWaveLUTSize() { return waveLUTSize; }
+    static constexpr int32_t getWaveMipLevels() { return waveMipLevels; }
+    static constexpr int32_t getWaveMipSize(int32_t level) { return waveMipSize(level); }
+    static constexpr int32_t getWaveMipLUTSize() { return waveMipStride() * static_cast<int32_t>(BaseWave::WAVE_TAIL); }
+    // index of the first entry of 'level' of 'wave' in getWaveMipLUT()
+    static constexpr int32_t getWaveMipOffset(BaseWave wave, int32_t level) {
+        int32_t offset = static_cast<int32_t>(wave) * waveMipStride();
+        for (int32_t l = 0; l < level; l++) offset += waveMipSize(l) + 1;
+        return offset;
+    }
+    // highest phase increment (rad/sample) the level plays without aliasing
+    static constexpr float getWaveMipLimit(int32_t level) {
+        return 2.0f * PI * 0.5f / (float)(waveMipTopHarmonics >> level);
+    }
+    // lowest level whose harmonics stay below Nyquist at 'increment'
+    static int32_t getWaveMipLevel(float increment) {
+        int32_t level = 0;
+        while (level < waveMipLevels - 1 && increment > getWaveMipLimit(level)) level++;
+        return level;
+    }
+    static constexpr int32_t getPow2_x_1200LUT_size() { return pow2_x_1200LUT_size; }
+    static constexpr int32_t getLowFrequencyCorrectionLUT_size() { return lowFrequencyCorrectionLUT_size; }
+};
+
+struct InstrumentBank; // immutable instrument version, shared_instruments.hpp
+
+
+class Sequencer {
+public:
+    // constant control params.
+    static constexpr int32_t numinstruments = 256;
+    static constexpr int32_t numPercussions = 128;
+    // voice pool size, chosen by initParam()
+    static constexpr int32_t defaultPolyphony = 64;
+    static constexpr int32_t maxPolyphony = 1024;
+    static constexpr int32_t numChannels = 32;
+
+private:
+    // constant control params.
+    static constexpr float delayBufferDuration = 500.0;// msec
+
+    struct Tone {
+        // from smf
+        Note note;
+        // points into 'bank', the instrument version the tone started with
+        const Instrument* instrument = nullptr;
+        std::shared_ptr<const InstrumentBank> bank;
+    };
+    SMFParser midi;
+
+    // Three tap delays run on delay lines after the voices: one shared send
+    // bus per program in use, fed by the voices of that program, or one line
+    // per voice for instruments with delayPerVoice. A line keeps running
+    // for its tail after the last voice stops sending, so voices end with
+    // their release and note-on does not touch the ring. Lines are added
+    // delayLineChunk at a time when a note-on finds none free, up to a bus per
+    // program and a line per voice slot.
+    static constexpr int32_t delayLineChunk = 16;
+    struct DelayTaps {
+        int32_t mask = 0;           // power of two above the longest tap, minus 1
+        int32_t tap0 = 0;           // samples ahead of the cursor
+        int32_t tap1 = 0;
+        int32_t tap2 = 0;
+        float ratio0 = 0.0f;
+        float ratio1 = 0.0f;
+        float ratio2 = 0.0f;
+        float mainRatio = 1.0f;
+        int32_t tailSamples = 0;    // run time after the last send
+        bool enabled = false;
+    };
+    struct DelayLine {
+        float* ring = nullptr;      // delayBufferSize entries in a delayLineChunks block
+        DelayTaps taps;
+        int32_t cursor = 0;
+        int32_t tailLeft = 0;
+        int32_t quietSamples = 0;   // run of output below cullGain without input
+        int32_t program = -1;       // bus of this program, -1: per voice line
+        bool inUse = false;
+        bool needsClear = false;    // ring holds a previous owner's tail
+        bool hasInput = false;      // a voice sent to the line in this buffer
+    };
+    int32_t delayBufferSize = 0;    // ring entries for delayBufferDuration (tap scale)
+    // calloc'ed: the OS zero fills the pages on first touch, and a line only
+    // touches the part of its ring its taps reach
+    std::vector<std::unique_ptr<float, decltype(&std::free)>> delayLineChunks;
+    std::vector<DelayLine> delayLines;                     // reserved for maxDelayLines, never moves
+    int32_t maxDelayLines = 0;
+    std::array<int32_t, numinstruments> delayBusOfProgram; // -1: none
+    std::vector<float> delayLineInput;                     // delayLines.size() * bufferSamples
+    float unitOfTime = 60000.0;
+    int32_t numTone = 0;            // voice pool size, the voices that may play at once
+    int32_t numToneSlots = 0;       // numTone and the fade reserve (see stealTone())
+    std::vector<Tone> toneInstances;
+    std::vector<int32_t> activeToneIndices;
+    std::vector<int32_t> freeToneIndices;
+
+    // One field of the tone SoA: numToneSlots entries carved from tonePool, each
+    // field starting on its own cache line.
+    template<typename T>
+    struct ToneField {
+        T* ptr = nullptr;
+        T& operator[](int32_t i) { return ptr[i]; }
+        const T& operator[](int32_t i) const { return ptr[i]; }
+    };
+    // calloc'ed by initParam() for the pool size, so every field starts at zero
+    std::unique_ptr<uint8_t, decltype(&std::free)> tonePool{nullptr, &std::free};
+    size_t tonePoolSize = 0;
+    size_t bindToneFields(uint8_t*);
+
+    // SoA hot data (indexed by toneInstances index) - order tuned for hot-path locality
+    ToneField<float> phase1;
+    ToneField<float> phase2;
+    ToneField<float> phase3;
+    ToneField<float> fmPhase;
+    ToneField<float> amPhase;
+    ToneField<float> fmIncrement;
+    ToneField<float> amIncrement;
+    ToneField<float> baseIncrement1;
+    ToneField<float> baseIncrement2;
+    ToneField<float> baseIncrement3;
+    ToneField<float> frequency;
+    ToneField<float> strength;
+    ToneField<float> atackedStrength;
+    ToneField<float> decayedStrength;
+    ToneField<float> atackedStrengthfloor;
+    ToneField<float> atackSlopeRatio;
+    ToneField<float> decaySlopeRatio;
+    ToneField<float> releaseSlopeRatio;
+    ToneField<float> base1ratio;
+    ToneField<float> base2ratio;
+    ToneField<float> base3ratio;
+    ToneField<float> freqNoiseCentharfRange;
+    ToneField<float> velocity_f;
+    ToneField<float> restartVelocity_f;
+    ToneField<float> tempo_f;
+    ToneField<float> restartTempo_f;
+    ToneField<float> waitDuration;
+    ToneField<float> restartWaitDuration;
+    ToneField<float> mainteinDuration;
+    ToneField<float> releaseTime;       // ms, the instrument's or stealFadeTime
+    ToneField<int32_t> noteStartTime;   // currentTime when note was registered
+    ToneField<int32_t> delayLineOfTone; // valid when useDelay
+    ToneField<double> passed;           // tone time (ms) at the start of the block
+    ToneField<int32_t> key;
+    ToneField<int32_t> waveLevel1; // wave mip level, see SharedLUT::getWaveMipLevel()
+    ToneField<int32_t> waveLevel2;
+    ToneField<int32_t> waveLevel3;
+    ToneField<int32_t> program;
+    ToneField<int32_t> velocity;
+    ToneField<int32_t> restartVelocity;
+    ToneField<int32_t> tempo;
+    ToneField<int32_t> restartTempo;
+    // hot-path flags / modes
+    ToneField<uint8_t> useFM;
+    ToneField<uint8_t> useAM;
+    ToneField<uint8_t> useDelay;
+    ToneField<uint8_t> useFreqNoise;
+    ToneField<uint8_t> freqNoiseMode;  // 0: white, 1: triangular, 2: cos4th
+    ToneField<uint8_t> noiseColorMode; // 0: white, 1: pink
+
+    // Voice stealing. When numTone voices are playing, a note-on fades the
+    // least important one out over stealFadeTime and plays on a voice of the
+    // fade reserve, so a stolen voice does not click. The candidates sit in a
+    // heap ordered by StealEntry::before(); it is rebuilt on the first steal
+    // after a render, and note-on / note-off push a new entry whose stamp
+    // outdates the tone's previous one.
+    static constexpr float stealFadeTime = 5.0f; // msec
+    struct StealEntry {
+        uint8_t held = 0;       // before its note-off
+        int8_t priority = 0;    // channelPriority of its channel
+        float level = 0.0f;     // envelope * velocity * gain, peak before the tone starts
+        int32_t startTime = 0;  // older tones go first
+        int32_t toneIndex = 0;
+        uint32_t stamp = 0;
+        // true when 'a' is to be stolen before 'b'
+        static bool before(const StealEntry& a, const StealEntry& b) {
+            if (a.held != b.held) return a.held < b.held;
+            if (a.priority != b.priority) return a.priority < b.priority;
+            if (a.level != b.level) return a.level < b.level;
+            return a.startTime < b.startTime;
+        }
+        // order of stealHeap: the next tone to steal at the front
+        static bool heapOrder(const StealEntry& a, const StealEntry& b) { return before(b, a); }
+    };
+    std::vector<StealEntry> stealHeap;
+    bool stealHeapValid = false;
+    int32_t fadingTones = 0;
+    int64_t stolenTones = 0;
+    ToneField<uint8_t> toneFading;      // stolen, in its fade
+    ToneField<uint8_t> toneCulled;      // held but below cullGain, not rendered
+    ToneField<uint32_t> stealStamp;
+    std::array<int8_t, numChannels> channelPriority{};
+    StealEntry makeStealEntry(int32_t) const;
+    void pushStealEntry(int32_t);
+    int32_t stealTone(float);
+    void releaseTone(size_t);
+    std::array<Percussion, numPercussions> percussions;
+
+    // Instruments compiled for this sampling rate, so that note-on copies
+    // fields instead of deriving them. Patch holds what depends on the
+    // instrument alone, KeyPatch what also depends on the key; key tables
+    // are filled on the first note of each key.
+    static constexpr int32_t numKeys = 128;
+    struct KeyPatch {
+        float frequency = 0.0f;
+        float baseIncrement1 = 0.0f;
+        float baseIncrement2 = 0.0f;
+        float baseIncrement3 = 0.0f;
+        int32_t waveLevel1 = 0;
+        int32_t waveLevel2 = 0;
+        int32_t waveLevel3 = 0;
+        bool valid = false;
+    };
+    struct alignas(64) Patch {
+        float base1ratio = 0.0f;
+        float base2ratio = 0.0f;
+        float base3ratio = 0.0f;
+        float fmPhase = 0.0f;
+        float fmIncrement = 0.0f;   // radians per sample, per unit of tempo/unitOfTime when fmSync
+        float amPhase = 0.0f;
+        float amIncrement = 0.0f;   // same for am
+        float freqNoiseCentharfRange = 0.0f;
+        float waveHeadroom = 1.0f;  // upward pitch range of fm and frequency noise, as a ratio
+        float atackSlopeRatio = 0.0f;
+        float decaySlopeRatio = 0.0f;
+        float releaseSlopeRatio = 0.0f;
+        DelayTaps delay;
+        uint8_t useFM = 0;
+        uint8_t useAM = 0;
+        uint8_t fmSync = 0;
+        uint8_t amSync = 0;
+        uint8_t useFreqNoise = 0;
+        uint8_t freqNoiseMode = 0;
+        uint8_t noiseColorMode = 0;
+        uint8_t delayPerVoice = 0;
+    };
+    std::array<Patch, numinstruments> patches;
+    std::array<std::unique_ptr<KeyPatch[]>, numinstruments> keyPatches;
+    uint32_t patchGeneration = 0;   // instrument bank generation the patches were compiled from
+    // Instrument version new tones start with, renewed at the start of each
+    // feed() without blocking (SharedInstruments::tryAcquire)
+    std::shared_ptr<const InstrumentBank> instrumentBank;
+    void compilePatches();
+    const KeyPatch& getKeyPatch(int32_t programNum, int32_t noteKey);
+
+    std::vector<EmittedEvent> eventQueue;
+    static constexpr int32_t initialEventCapacity = 64;
+    static constexpr int32_t maxEventCapacity = 1024;
+
+    float samplingRate = 44100.0f;
+    float bufferingTime = 0.05f;
+    int32_t bufferSamples = 0;
+
+    int32_t currentTime = 0;        // sequence time (ms) at the end of the last block, rounded up
+    double sequenceTime = 0.0;      // the same, exact
+    int32_t blockSamples = 0;       // samples of the block being rendered, up to bufferSamples
+    int32_t noisePos = 0;           // sample offset into the noise LUTs
+    int32_t noiseBufSize;
+    int32_t noiseBuffer;
+    bool isSet = false;
+    // LUTs are now shared via SharedLUT class
+    
+    float sustainRate = 0.0;
+    
+    float asumedConcurrentTone = 4.0f;
+    float preOnTime = 0.0f; // Pre-on signal time in milliseconds (0 = disabled)
+    // sampleOffset >= 0: a live event, at that sample of the block rather than at note.startTime
+    bool checkNewNote(Note, bool forPreOnOff = false, int32_t sampleOffset = -1);
+    int32_t logLevel = 1;
+
+    // Voice-parallel rendering (see voice_kernel.hpp). nullptr selects the
+    // scalar reference path.
+    struct ToneCursor {
+        float current;
+        float releaseStart;
+        float releaseEnd;
+        float attackEnd;
+        int32_t toneBegin;      // sounding sample range of the current block
+        int32_t toneEnd;
+        const float* freqNoiseLUT;
+        int32_t fmWave;
+        float fmWaveInvert;
+        int32_t amWave;
+        float amWaveInvert;
+        bool isEnd;
+    };
+    static constexpr int32_t laneBlockSamples = 64;
+    static constexpr float maxIncrement = 2.0f * PI * 0.47f; // 0.47 of the sampling rate
+    static constexpr int32_t laneBlockSize = laneBlockSamples * VoiceKernel::maxWidth;
+    RenderKernel renderKernel = RenderKernel::RK_AUTO;
+    float masterKnee = 1.0f;
+    static constexpr int32_t maxControlRate = 32;
+    int32_t controlRate = 1;
+    ToneField<float> controlGain;  // last control step, start of the next ramp
+    ToneField<float> controlRatio;
+    const VoiceKernel* voiceKernel = nullptr;
+    // kernel buffers of one lane group, one set per render thread
+    struct LaneScratch {
+        alignas(64) std::array<float, laneBlockSize> inc1{};
+        alignas(64) std::array<float, laneBlockSize> inc2{};
+        alignas(64) std::array<float, laneBlockSize> inc3{};
+        alignas(64) std::array<float, laneBlockSize> gain{};
+        alignas(64) std::array<float, laneBlockSize> out{};
+        std::array<uint8_t, laneBlockSize> sounding{};
+    };
+    std::vector<LaneScratch> laneScratch;
+    ToneField<uint8_t> toneEnded;
+
+    // Lane groups are rendered as jobs of a work-stealing pool. Every group
+    // writes its dry mix and the delay send of each lane to its own slice of
+    // groupOut; the slices are summed in group order, so the output does not
+    // depend on the number of threads.
+    static constexpr int32_t maxRenderThreads = WorkerPool::maxThreads;
+    int32_t renderThreads = 1;
+    WorkerPool workerPool;
+    std::vector<float> groupOut;
+    void prepareLaneGroups();
+
+    // Audibility culling. After each buffer, a tone past its attack whose
+    // envelope gain (velocity * strength * gain / divisionNum) is below
+    // cullGain can only get quieter: a released one is retired, a held one
+    // stops rendering until its note-off retires it. A delay line without
+    // input whose output stayed below cullGain for a whole ring is released.
+    float cullLevel = -100.0f;      // dB
+    float cullGain = 1.0e-5f;       // 0: never
+    std::vector<int32_t> renderToneIndices; // the active tones rendered in this buffer
+    int32_t blockRenderedSamples = 0;
+    int32_t blockSkippedSamples = 0;
+    CullStats cullStats;
+    bool cullTone(int32_t);
+
+    // Live input. Producers push to liveQueue without locking; feed() moves
+    // the events into livePending, sorted by time, and applies the ones due
+    // in the block. The sample clock counts the samples rendered since
+    // initParam(); clockOrigin is the steady clock time of its sample 0,
+    // smoothed over the feed() calls, so stampLiveEvent() can map "now" onto
+    // it without the jitter of the audio callbacks.
+    static constexpr int32_t liveQueueSize = 1024;
+    static constexpr int32_t clockSmoothing = 16;     // feed() calls the clock origin is averaged over
+    static constexpr double clockResyncMs = 100.0;    // origin error that restarts it (pause, stall)
+    MpscQueue<LiveEvent> liveQueue;
+    std::vector<LiveEvent> livePending;
+    std::atomic<int64_t> sampleClock{0};
+    std::atomic<int64_t> clockOrigin{0};    // ns, 0: not fed yet
+    std::atomic<double> clockRate{0.0};     // samples per ns
+    std::atomic<int32_t> livePeriod{0};     // longest feed(), one audio period
+    std::atomic<int64_t> liveApplied{0};
+    std::atomic<int64_t> liveLate{0};
+    std::atomic<int64_t> liveDropped{0};
+    bool postLiveEvent(const LiveEvent&);
+    void updateSampleClock(int32_t frames);
+    void applyLiveEvents();
+public:
+    double maxValue = 0.0;
+    float noteFrequency(int8_t);
+    float centFrequency(float, float);
+    bool initParam(double, double, int32_t, int32_t = defaultPolyphony);
+    std::array<Instrument, numinstruments> getInstruments(void) const;
+    void setInstruments(const std::array<Instrument, numinstruments>&);
+    void setControlParams(const ControlParams&);
+    ControlParams getControlParams(void) const;
+    void setPercussions(const std::array<Percussion, numPercussions>&);
+    const std::array<Percussion, numPercussions>& getPercussions(void) const;
+    // Live input, from any thread without locking. The event plays at
+    // sampleTime on the sample clock; -1 stamps it with stampLiveEvent().
+    // Events whose time is already rendered play at the start of the next
+    // block. Return false when the queue is full.
+    bool incertNoteOn(Note, int64_t sampleTime = -1);
+    bool incertNoteOff(Note, int64_t sampleTime = -1);
+    bool postChannelPriority(int32_t channel, int32_t priority, int64_t sampleTime = -1);
+    // samples rendered since initParam()
+    int64_t getSampleClock() const { return sampleClock.load(std::memory_order_acquire); }
+    // Sample clock time for an event raised now: the current position plus
+    // one and a half audio periods, so it falls into a block that has not
+    // started yet and every event gets the same latency.
+    int64_t stampLiveEvent() const;
+    LiveInputStats getLiveInputStats() const;
+    bool feed(float*);
+    bool feed(float*, int32_t);
+    bool smfLoad(const char*, double);
+    bool smfLoad(const uint8_t*, size_t, double);
+    // Swaps in a song decoded by SMFParser::load() without the sequencer lock,
+    // so feed() only waits for the swap. 'parsed' gets the previous song, to be
+    // freed after the lock is released.
+    void smfAdopt(SMFParser &parsed, double givenUnitOfTime);
+    bool smfUnload(void);
+    // Jumps to 'ms' of the song. Sounding voices stop (with their note-off
+    // signals), the pre-on notes announced at the old position get their
+    // pre-on offs, and the notes held at the new position start again at the
+    // next block, but those of an instrument without sustain that have decayed
+    // by then stay off. Call while feed() is not running.
+    bool smfSeek(int32_t ms);
+    int32_t getSongPosition() const;    // ms of the song, without the pre-on delay
+    int32_t getSongLength() const { return midi.getLength(); }
+    int32_t getBufferSamples() const { return bufferSamples; }
+    float getSamplingRate() const { return samplingRate; }
+    int32_t getActiveToneCount() const { return (int32_t)activeToneIndices.size(); }
+    int32_t getPolyphony() const { return numTone; }
+    int64_t getStolenToneCount() const { return stolenTones; }
+    const CullStats& getCullStats() const { return cullStats; }
+    void setChannelPriority(int32_t, int32_t);
+    // bytes of the per-voice data, which grows with the pool size
+    size_t getVoiceMemory() const {
+        return tonePoolSize + toneInstances.size() * sizeof(Tone)
+             + (freeToneIndices.capacity() + activeToneIndices.capacity() + renderToneIndices.capacity()) * sizeof(int32_t)
+             + stealHeap.capacity() * sizeof(StealEntry) + groupOut.size() * sizeof(float);
+    }
+    const char* getRenderKernelName() const { return (voiceKernel != nullptr) ? voiceKernel->name : "scalar"; }
+    std::function<void(const EmittedEvent&)> emitSignal;
+    Sequencer();
+    ~Sequencer();
+private:
+    void enqueueNoteEvent(int32_t onOff, const Tone& tone, int32_t instrumentNum, int32_t key2, int32_t msg = 0);
+    void enqueueNoteEvent(int32_t onOff, const Note& note, int32_t msg = 0); // For preOnOff signals (no Tone)
+    void enqueueLevelEvent(double maxValue, double maxFrameValue, int32_t renderedSamples, int32_t skippedSamples);
+    void flushEvents();
+    void renderBlock(float *frame);
+    void renderTonesScalar(float *frame, int32_t noiseBufIndex);
+    void renderTonesLanes(float *frame, int32_t noiseBufIndex);
+    void renderLaneGroup(int32_t groupTop, int32_t lanes, LaneScratch &scratch, int32_t noiseBufIndex, float *dry, float *sends);
+    void beginToneCursor(int32_t toneIndex, ToneCursor &cursor);
+    void renderToneControl(int32_t toneIndex, ToneCursor &cursor, LaneScratch &scratch, int32_t offset, int32_t count, int32_t lane, int32_t width, int32_t noiseBufIndex);
+    int32_t renderToneEnvelope(int32_t toneIndex, ToneCursor &cursor, int32_t count, float *env, float *sounding, int32_t &toneBegin, int32_t &toneEnd);
+    void sendToneToDelay(const ToneCursor &cursor, LaneScratch &scratch, int32_t lane, int32_t width, float *send);
+    bool growDelayLines(void);
+    bool mayStillSound(const Note &note, int32_t age) const;
+    int32_t acquireDelayLine(const Patch &patch, int32_t programNum);
+    bool renderDelayLines(float *frame);
+};
+
+#endif // SEQUENCER_H
+
@@ -0,0 +1,63 @@
+
+#include "shared_instruments.hpp"
+
+#include <algorithm>
+
+SharedInstruments& SharedInstruments::getInstance() {
+    static SharedInstruments instance;
+    return instance;
+}
+
+SharedInstruments::SharedInstruments() {
+    auto bank = std::make_shared<InstrumentBank>();
+    bank->instruments = defaultInstruments;
+    bank->generation = generation_.load(std::memory_order_relaxed);
+    current_ = std::move(bank);
+}
+
+SharedInstruments::Snapshot SharedInstruments::getSnapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reclaim();
+    return current_;
+}
+
+bool SharedInstruments::tryAcquire(Snapshot& pinned) {
+    if (pinned && pinned->generation == generation_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false; // a publish is in progress, take it at the next buffer
+    }
+    pinned = current_; // the old version is on the retired list, this does not free it
+    return true;
+}
+
+void SharedInstruments::setInstruments(const std::array<Instrument, Sequencer::numinstruments>& instruments) {
+    auto bank = std::make_shared<InstrumentBank>();
+    bank->instruments = instruments;
+    std::lock_guard<std::mutex> lock(mutex_);
+    bank->generation = generation_.load(std::memory_order_relaxed) + 1;
+    retired_.push_back(std::move(current_));
+    current_ = std::move(bank);
+    generation_.store(current_->generation, std::memory_order_release);
+    reclaim();
+}
+
+uint32_t SharedInstruments::getGeneration() const {
+    return generation_.load(std::memory_order_acquire);
+}
+
+// Frees the retired versions only the list still holds. A version off
+// current_ can not be pinned again, so a count of one stays one.
+// The caller holds mutex_.
+void SharedInstruments::reclaim() {
+    retired_.erase(std::remove_if(retired_.begin(), retired_.end(), [](const Snapshot& bank) {
+        if (bank.use_count() != 1) {
+            return false;
+        }
+        // pairs with the release of the last reader's reference
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }), retired_.end());
+}
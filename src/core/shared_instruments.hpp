@@ -0,0 +1,63 @@
+#ifndef SHARED_INSTRUMENTS_H
+#define SHARED_INSTRUMENTS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "instrument.hpp"
+
+// One published version of the instruments. Never changed after publishing.
+struct InstrumentBank {
+    std::array<Instrument, Sequencer::numinstruments> instruments;
+    uint32_t generation = 0;
+};
+
+// Process-wide instrument bank, published as immutable versions (RCU style).
+//
+// setInstruments() builds a new version and swaps it in; it never writes into
+// a version a Sequencer reads. A Sequencer pins the current version at the
+// start of each buffer with tryAcquire(), which never blocks: while a publish
+// holds the lock it keeps the version it has and takes the new one at its
+// next buffer. Tones keep the version they started with, so an edit never
+// tears the parameters of a sounding voice. Replaced versions stay on a
+// retired list until no Sequencer or tone holds them, and are freed on the
+// writer's thread, never on the render threads.
+class SharedInstruments {
+public:
+    using Snapshot = std::shared_ptr<const InstrumentBank>;
+
+    // Access singleton instance
+    static SharedInstruments& getInstance();
+
+    // Current version, for the main thread (waits for a publish in progress)
+    Snapshot getSnapshot();
+
+    // Render side: moves 'pinned' to the current version when a newer one is
+    // published and the lock is free. Never blocks; returns true on a change.
+    bool tryAcquire(Snapshot& pinned);
+
+    // Publishes a new version
+    void setInstruments(const std::array<Instrument, Sequencer::numinstruments>& instruments);
+
+    // Generation of the latest version, bumped by every setInstruments()
+    uint32_t getGeneration() const;
+
+private:
+    SharedInstruments();
+    SharedInstruments(const SharedInstruments&) = delete;
+    SharedInstruments& operator=(const SharedInstruments&) = delete;
+    SharedInstruments(SharedInstruments&&) = delete;
+    SharedInstruments& operator=(SharedInstruments&&) = delete;
+    void reclaim();
+
+    std::mutex mutex_;                  // current_ and retired_
+    Snapshot current_;
+    std::vector<Snapshot> retired_;     // replaced versions, until no one holds them
+    std::atomic<uint32_t> generation_{1};
+};
+
+#endif
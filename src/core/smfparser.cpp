@@ -0,0 +1,614 @@
+/**************************************************************************/
+/*  smfparser.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "smfparser.hpp"
+#include "mapped_file.hpp"
+
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+#include "debug_print.hpp"
+#endif // DEBUG_ENABLED && WINDOWS_ENABLED
+
+SMFParser::SMFParser() : unitOfTime(60000.0f), position(0) {
+}
+
+SMFParser::~SMFParser(){
+    timeline.clear();
+}
+
+
+void SMFParser::unload(void) {
+    
+    position = 0;
+    filesize = 0;
+    formatType = 0;
+    numOfTracks = 0;
+    timeDivision = 0;
+    image = nullptr;
+    tempoMap.clear();
+    timeline.clear();
+    checkpoints.clear();
+    checkpointHeld.clear();
+    cursor = 0;
+    cursorPreOnOff = 0;
+    
+}
+
+bool SMFParser::load(const char *name) {
+    // reset previous state in case caller skipped unload
+    unload();
+
+    // decoded straight from the mapped file, nothing is copied
+    MappedFile file;
+    if (!file.open(name)) return false;
+    return load(file.data(), file.size());
+}
+
+
+bool SMFParser::load(const uint8_t *data, size_t size) {
+    // reset previous state in case caller skipped unload
+    unload();
+
+    position = 0;
+    if (data == nullptr) return false;
+
+    // the events are decoded from the caller's bytes, which need not outlive load()
+    image = data;
+    filesize = size;
+    bool ok = parseHeader();
+    image = nullptr;
+    if (!ok) {
+        unload();
+        return false;
+    }
+    return true;
+}
+
+
+bool SMFParser::parseHeader(void) {
+    position = 0;
+    if (filesize < 14) return false;
+
+    { // check Mthd marker
+        std::string str = getStr(4);
+        if (str.compare("MThd") != 0) return false;
+    }
+    { // check data length that must be 6
+        uint32_t chunkSize = getBytes(4);
+        if (chunkSize != 6) return false;
+    }
+    { // check formatType that must be 0 or 1
+        formatType = getBytes(2);
+        if (formatType != 0 && formatType != 1) return false;
+    }
+    { // get numOfTracks
+        numOfTracks = getBytes(2);
+        if (formatType == 0 && numOfTracks != 1) return false;
+        else if (formatType == 1 && numOfTracks < 1) return false;
+        else if (formatType != 0 && formatType != 1) return false;
+    }
+    { // get timeDivision
+        timeDivision = getBytes(2);
+        if (timeDivision & 0x8000) return false; // currently, not supported SMPTE format
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> chunks; // top and tail of each MTrk
+    for (int32_t i = 0; i < numOfTracks; ++i) {
+        std::string str = getStr(4);
+        if (str.compare("MTrk") != 0) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+#endif // DEBUG_ENABLED
+            return false;
+        }
+        uint32_t length = getBytes(4);
+        uint32_t top = position;
+        // a truncated file ends its last chunk early
+        position = (uint32_t)std::min<uint64_t>((uint64_t)top + length, filesize);
+        chunks.push_back({top, position});
+    }
+    return buildTimeline(chunks);
+}
+
+
+bool SMFParser::buildTimeline(const std::vector<std::pair<uint32_t, uint32_t>>& chunks) {
+    tempoMap.clear();
+
+    std::vector<std::vector<TimelineEvent>> trackEvents(chunks.size());
+    size_t total = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        decodeTrack(chunks[i].first, chunks[i].second, (uint16_t)i, trackEvents[i]);
+        total += trackEvents[i].size();
+    }
+    tempoMap.build(timeDivision);
+
+    // k-way merge: the head of every track sits in a min-heap keyed by
+    // (tick, track), so equal ticks keep the track order the player used
+    // to serve them in.
+    struct Head {
+        uint32_t tick;
+        uint16_t track;
+        size_t index;
+        bool operator>(const Head& another) const {
+            return tick != another.tick ? tick > another.tick : track > another.track;
+        }
+    };
+    std::vector<Head> heap;
+    heap.reserve(trackEvents.size());
+    for (size_t i = 0; i < trackEvents.size(); ++i) {
+        if (!trackEvents[i].empty()) heap.push_back({trackEvents[i][0].tick, (uint16_t)i, 0});
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<Head>());
+
+    timeline.clear();
+    timeline.reserve(total);
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Head>());
+        Head& head = heap.back();
+        const std::vector<TimelineEvent>& events = trackEvents[head.track];
+        timeline.push_back(events[head.index]);
+        if (++head.index < events.size()) {
+            head.tick = events[head.index].tick;
+            std::push_heap(heap.begin(), heap.end(), std::greater<Head>());
+        } else {
+            heap.pop_back();
+        }
+    }
+
+    computeTimes();
+    cursor = 0;
+    cursorPreOnOff = 0;
+    return true;
+}
+
+
+void SMFParser::decodeTrack(uint32_t top, uint32_t tail, uint16_t trackNum, std::vector<TimelineEvent>& events) {
+    uint32_t pos = top;
+    uint32_t tick = 0;
+    uint8_t previousEvent = 0;
+    int8_t program = 0;
+    // a note event takes at least 3 bytes (delta, key, velocity with running status)
+    events.reserve((tail - top) / 3);
+
+    while (pos < tail) {
+        uint32_t delta = getVarLen(&pos);
+        tick += delta;
+        if (pos >= tail) break; // truncated: no event after the delta
+        uint8_t event = getByte(&pos);
+
+        if (event < 0x80) {
+            event = previousEvent;
+            skipByte(-1, &pos);
+            if(event == 0) {
+                continue; // SysEx event
+            }
+        } else {
+            previousEvent = ((event & 0xf0) != 0xf0) ? event : 0;
+        }
+        uint8_t channel = event & 0xf;
+
+        switch(event & 0xf0) {
+            case 0x80: // note off
+                {
+                    if (pos + 2 > tail) return; // truncated
+                    uint8_t key_byte = getByte(&pos);
+                    uint8_t velocity_byte = getByte(&pos);
+                    events.push_back({tick, 0, 0, trackNum, (uint8_t)NState::NS_OFF, channel, key_byte, velocity_byte, program, 0, 0});
+                }
+                break;
+
+            case 0x90: // note on
+                {
+                    if (pos + 2 > tail) return; // truncated
+                    uint8_t key_byte = getByte(&pos);
+                    uint8_t velocity_byte = getByte(&pos);
+
+                    NState state = NState::NS_OFF;
+                    if (velocity_byte != 0) state = NState::NS_ON_FOREVER;
+
+                    events.push_back({tick, 0, 0, trackNum, (uint8_t)state, channel, key_byte, velocity_byte, program, 0, 0});
+                }
+                break;
+
+            case 0xa0: //Polyphonic Pressure (ignored)
+                {
+                    skipByte(2, &pos);
+                }
+                break;
+
+            case 0xb0: // Controller (ignored)
+                {
+                    skipByte(2, &pos);
+                }
+                break;
+
+            case 0xc0: // program change
+                {
+                    if (pos >= tail) return; // truncated
+                    program = getByte(&pos);
+                }
+                break;
+
+            case 0xd0: // Channel Pressure (ignored)
+                {
+                    skipByte(1, &pos);
+                }
+                break;
+
+            case 0xe0: // pitch bend (currently, ignored)
+                {
+                    skipByte(2, &pos);
+                }
+                break;
+
+            case 0xf0: // SysEx event
+                {
+                    if (event == 0xf0) {// System Exclusive Message Begin
+                        uint32_t len = getVarLen(&pos);
+                        skipByte(len, &pos);
+                    }
+                    else if (event == 0xf7) { // System Exclusive Message End
+                        uint32_t len = getVarLen(&pos);
+                        skipByte(len, &pos);
+                    }
+                    else if (event == 0xff) {
+                        uint8_t type = getByte(&pos);
+                        uint32_t value = getVarLen(&pos);
+
+                        switch(type) {
+                            case 0x00: // MetaSequence
+                                skipByte(2, &pos);
+                                break;
+
+                            case 0x20: // MetaChannelPrefix
+                            case 0x21: // Meta Port
+                                skipByte(1, &pos);
+                                break;
+
+                            case 0x2f: // END OF TRACK
+                                return;
+
+                            case 0x51: // MetaSetTempo
+                                {
+                                    if (pos + 3 > tail) return; // truncated
+                                    uint32_t metaSetTempo = getBytes(3, &pos);
+                                    tempoMap.add(tick, metaSetTempo);
+                                }
+                                break;
+
+                            case 0x54: // MetaSMPTEOffset
+                                skipByte(5, &pos);
+                                break;
+
+                            case 0x58: // MetaTimeSignature
+                                skipByte(4, &pos);
+                                break;
+
+                            case 0x59: // MetaKeySignature
+                                skipByte(2, &pos);
+                                break;
+
+                            default: // text, lyrics, markers, sequencer specific, ...
+                                skipByte(value, &pos);
+                                break;
+                        }
+                    }
+                }
+                break;
+
+            default:break;
+        }
+    }
+}
+
+
+void SMFParser::computeTimes(void) {
+    // unitOfTime is the length of a minute (60000000 us) in timeline units
+    const double msPerMicro = (double)unitOfTime / 60000000.0;
+    for (TimelineEvent& event : timeline) {
+        event.tempo = tempoMap.getBPM(event.tick);
+        event.time = (int32_t)(tempoMap.tickToMicros(event.tick) * msPerMicro);
+    }
+    buildCheckpoints();
+}
+
+
+void SMFParser::buildCheckpoints(void) {
+    checkpoints.clear();
+    checkpointHeld.clear();
+    // the working sets pair the note-offs and are not capped; a checkpoint
+    // keeps the maxHeldNotes most recent note-ons of each
+    std::vector<uint32_t> held, heldPreOnOff;
+    auto store = [&](const std::vector<uint32_t>& set) {
+        const size_t keep = std::min(set.size(), maxHeldNotes);
+        checkpointHeld.insert(checkpointHeld.end(), set.end() - (std::ptrdiff_t)keep, set.end());
+    };
+    int32_t nextTime = 0;
+    for (size_t i = 0; i <= timeline.size(); ++i) {
+        const int32_t time = (i < timeline.size()) ? timeline[i].time : INT32_MAX;
+        while (nextTime <= time && nextTime <= getLength()) {
+            Checkpoint checkpoint;
+            checkpoint.index = (uint32_t)i;
+            checkpoint.heldBegin = (uint32_t)checkpointHeld.size();
+            store(held);
+            checkpoint.heldEnd = checkpoint.preOnBegin = (uint32_t)checkpointHeld.size();
+            store(heldPreOnOff);
+            checkpoint.preOnEnd = (uint32_t)checkpointHeld.size();
+            checkpoints.push_back(checkpoint);
+            nextTime += checkpointInterval;
+        }
+        if (i == timeline.size()) break;
+        updateHeld(held, i, false);
+        // the pre-on note-offs are paired here once, not while playing
+        const int32_t on = updateHeld(heldPreOnOff, i, true);
+        TimelineEvent& event = timeline[i];
+        if ((NState)event.state == NState::NS_OFF) {
+            event.preOnPaired = (on >= 0) ? 1 : 0;
+            event.preOnProgram = (on >= 0) ? timeline[on].program : 0;
+        }
+    }
+}
+
+
+// index of the first event at or after 'time'
+size_t SMFParser::findEvent(int32_t time) const {
+    auto it = std::lower_bound(timeline.begin(), timeline.end(), time, [](const TimelineEvent& event, int32_t t) {
+        return event.time < t;
+    });
+    return (size_t)(it - timeline.begin());
+}
+
+
+// Adds the note-on at 'index' to 'held', or removes the note-on a note-off
+// at 'index' turns off: the first or the last one of its channel and key.
+// Returns the index of that note-on, -1 for a note-on or an unmatched note-off.
+int32_t SMFParser::updateHeld(std::vector<uint32_t>& held, size_t index, bool firstMatch) const {
+    const TimelineEvent& event = timeline[index];
+    if ((NState)event.state == NState::NS_ON_FOREVER) {
+        held.push_back((uint32_t)index);
+        return -1;
+    }
+    auto matches = [&](uint32_t i) {
+        return timeline[i].channel == event.channel && timeline[i].key == event.key;
+    };
+    if (firstMatch) {
+        auto it = std::find_if(held.begin(), held.end(), matches);
+        if (it == held.end()) return -1;
+        const int32_t on = (int32_t)*it;
+        held.erase(it);
+        return on;
+    }
+    auto it = std::find_if(held.rbegin(), held.rend(), matches);
+    if (it == held.rend()) return -1;
+    const int32_t on = (int32_t)*it;
+    held.erase(std::next(it).base());
+    return on;
+}
+
+
+// the note-ons before 'index' not yet turned off: from the last checkpoint
+// at or before it, forward over the events in between
+void SMFParser::heldBefore(size_t index, std::vector<uint32_t>& held, bool forPreOnOff) const {
+    held.clear();
+    if (checkpoints.empty()) return;
+    auto it = std::upper_bound(checkpoints.begin(), checkpoints.end(), index, [](size_t i, const Checkpoint& checkpoint) {
+        return i < checkpoint.index;
+    });
+    const Checkpoint& checkpoint = *(it - 1);
+    if (forPreOnOff) {
+        held.assign(checkpointHeld.begin() + checkpoint.preOnBegin, checkpointHeld.begin() + checkpoint.preOnEnd);
+    } else {
+        held.assign(checkpointHeld.begin() + checkpoint.heldBegin, checkpointHeld.begin() + checkpoint.heldEnd);
+    }
+    for (size_t i = checkpoint.index; i < index; ++i) {
+        updateHeld(held, i, forPreOnOff);
+    }
+}
+
+
+Note SMFParser::makeNote(const TimelineEvent& event) const {
+    return {
+        .state        = (NState)event.state,
+        .trackNum     = (int32_t)event.track,
+        .channel      = (int32_t)event.channel,
+        .key          = (int32_t)event.key,
+        .velocity     = (int32_t)event.velocity,
+        .program      = (int32_t)event.program,
+        .startTick    = event.tick,
+        .startTime    = event.time,
+        .tempo        = event.tempo
+    };
+}
+
+
+int32_t SMFParser::seek(int32_t time, std::vector<Note>& held, std::vector<Note>& heldPreOnOff) {
+    held.clear();
+    heldPreOnOff.clear();
+    time = std::clamp(time, 0, getLength());
+
+    std::vector<uint32_t> indices;
+    cursor = findEvent(time);
+    heldBefore(cursor, indices, false);
+    for (uint32_t i : indices) held.push_back(makeNote(timeline[i]));
+
+    // the pre-on sequence runs preOnTime ahead of the normal one
+    if (preOnTime > 0.0f) {
+        cursorPreOnOff = findEvent(time + (int32_t)preOnTime);
+        heldBefore(cursorPreOnOff, indices, true);
+        for (uint32_t i : indices) heldPreOnOff.push_back(makeNote(timeline[i]));
+    } else {
+        cursorPreOnOff = cursor;
+    }
+    return time;
+}
+
+
+void SMFParser::getHeldPreOnOff(std::vector<Note>& held) const {
+    held.clear();
+    std::vector<uint32_t> indices;
+    heldBefore(cursorPreOnOff, indices, true);
+    for (uint32_t i : indices) held.push_back(makeNote(timeline[i]));
+}
+
+
+void SMFParser::restart(void) {
+    cursor = 0;
+    cursorPreOnOff = 0;
+}
+
+
+Note SMFParser::parse(int32_t till, bool forPreOnOff) {
+    Note retNote;
+    retNote.state = NState::NS_EMPTY;
+    
+    // Early exit if no MIDI file is loaded
+    if (numOfTracks == 0) {
+        return retNote;
+    }
+    
+    // Select cursor to use (preOnOff sequence or normal sequence)
+    size_t& activeCursor = forPreOnOff ? cursorPreOnOff : cursor;
+    if (forPreOnOff) {
+        // a note-off without a pre-on note-on to turn off emits nothing
+        while (activeCursor < timeline.size() && (NState)timeline[activeCursor].state == NState::NS_OFF
+               && timeline[activeCursor].preOnPaired == 0) {
+            ++activeCursor;
+        }
+    }
+    if (activeCursor >= timeline.size()) {
+        retNote.state = NState::NS_END;
+        return retNote;
+    }
+
+    const TimelineEvent& event = timeline[activeCursor];
+    int32_t startTime = event.time;
+    // For normal sequence (not preOnOff), add preOnTime offset
+    // This makes the note's startTime relative to the delayed playback start
+    if (!forPreOnOff && preOnTime > 0.0f) {
+        startTime += (int32_t)preOnTime;
+    }
+    if (startTime < till) {
+        ++activeCursor;
+        retNote = makeNote(event);
+        retNote.startTime = startTime;
+        // a pre-on note-off reports the program of the note-on it turns off
+        if (forPreOnOff && retNote.state == NState::NS_OFF) retNote.program = event.preOnProgram;
+    }
+    return retNote;
+}
+
+
+void SMFParser::setUnitOfTime(float unit) {
+    unitOfTime = unit;
+    computeTimes();
+}
+
+float SMFParser::getUnitOfTime() const {
+    return unitOfTime;
+}
+
+
+uint32_t SMFParser::getBytes(uint16_t length) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < length; ++i)
+        value = (value << 8) | getByte();
+    return value;
+}
+
+
+uint32_t SMFParser::getBytes(uint16_t length, uint32_t *pos) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < length; ++i)
+        value = (value << 8) | getByte(pos);
+    return value;
+}
+
+
+uint8_t SMFParser::getByte() {
+    if (position >= filesize) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("[SMFParser] getByte() out of bounds: position=", position, ", filesize=", filesize);
+#endif // DEBUG_ENABLED && WINDOWS_ENABLED
+        return 0;  // Return safe default value
+    }
+    uint8_t value = image[position];
+    ++position;
+    return value;
+}
+
+
+uint8_t SMFParser::getByte(uint32_t *pos) {
+    if (*pos >= filesize) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        gdsynth::print("[SMFParser] getByte(pos) out of bounds: *pos=", *pos, ", filesize=", filesize);
+#endif // DEBUG_ENABLED && WINDOWS_ENABLED
+        return 0;  // Return safe default value
+    }
+    uint8_t value = image[*pos];
+    ++(*pos);
+    return value;
+}
+
+
+void SMFParser::skipByte(int32_t length) {
+    position += length;
+}
+
+
+void SMFParser::skipByte(int32_t length, uint32_t *pos) {
+    (*pos) += length;
+}
+
+
+std::string SMFParser::getStr(uint16_t length) {
+    std::string str = "";
+    for (uint16_t i = 0; i < length; ++i)
+        str += getByte();
+    return str;
+}
+
+
+std::string SMFParser::getStr(uint16_t length, uint32_t *pos) {
+    std::string str = "";
+    for (uint16_t i = 0; i < length; ++i)
+        str += getByte(pos);
+    return str;
+}
+
+
+uint32_t SMFParser::getVarLen(uint32_t *pos) {
+    uint32_t value = getByte(pos);
+    if (value & 0x80) {
+        value &= 0x7f;
+        uint8_t byteRead = 0;
+        do {
+            byteRead = getByte(pos);
+            value = (value << 7) | (byteRead & 0x7f);
+        } while (byteRead & 0x80);
+    }
+    return value;
+}
+
@@ -36,7 +36,8 @@
 #include <fstream>
 #include <algorithm>
 #include <memory>
-#include <godot_cpp/classes/file_access.hpp>
+
+#include "tempo_map.hpp"
 
 enum class NState {
     NS_OFF,          //  0
@@ -48,14 +49,6 @@ enum class NState {
     NS_TAIL
 };
 
-enum class TState {
-    TS_EMPTY,     //  0
-    TS_FOUND,     //  1
-    TS_SERVED,    //  2
-
-    TS_TAIL
-};
-
 struct Note {
     NState state;
     int32_t trackNum;
@@ -86,6 +79,7 @@ private:
     void skipByte(int32_t, uint32_t *);
     uint32_t getVarLen(uint32_t *);
     std::string getStr(uint16_t, uint32_t *);
+    bool parseHeader(void);
     
     
     // context
@@ -95,41 +89,70 @@ private:
     
     uint32_t position;
     float unitOfTime;
-    uint32_t tempo;
+    TempoMap tempoMap;
 
-    struct Track {
-        TState state;
-        std::vector<Note> notes;
+    // The song is decoded once at load: the note events of every MTrk chunk
+    // are merged into one array in playback order (tick, then track, then
+    // file order) and get their times from the tempo map. parse() only
+    // steps a cursor, so a buffer costs as much as the notes it plays,
+    // whatever the number of tracks.
+    struct TimelineEvent {
         uint32_t tick;
-        uint32_t top;
-        uint32_t length;
-        uint32_t tail;
-        uint32_t tempo;
-        uint32_t position;
-        uint8_t previousEvent = 0;
-        int8_t program = 0;
-        Note nextNote;
+        int32_t time;           // ms from the song start, without the pre-on delay
+        int32_t tempo;          // BPM in effect
+        uint16_t track;
+        uint8_t state;          // NState
+        uint8_t channel;
+        uint8_t key;
+        uint8_t velocity;
+        int8_t program;
+        // NS_OFF in the pre-on sequence, which pairs a note-off with the oldest
+        // held note-on of its channel and key: whether there is one, and its program
+        uint8_t preOnPaired;
+        int8_t preOnProgram;
     };
-    std::vector<Track> tracks;
-    std::vector<Track> tracksPreOnOff; // For preOnOff sequence (independent context)
+    std::vector<TimelineEvent> timeline;
+    size_t cursor = 0;          // next event of the normal sequence
+    size_t cursorPreOnOff = 0;  // next event of the preOnOff sequence
+    void decodeTrack(uint32_t top, uint32_t tail, uint16_t trackNum, std::vector<TimelineEvent>&);
+    bool buildTimeline(const std::vector<std::pair<uint32_t, uint32_t>>& chunks);
+    void computeTimes(void);
 
-    struct Tempo {
-        uint32_t tick, tempo;
-        float time;
-        bool operator<(const Tempo& another) const {
-            return tick < another.tick;
-        }
+    // Seek support: every checkpointInterval ms of song time, the timeline
+    // index there and the note-ons still held before it (their indices,
+    // stored back to back in checkpointHeld), as the normal sequence pairs
+    // note-offs (last match) and as the pre-on one does (first match).
+    // Program and tempo are resolved per event, so nothing else has to be
+    // restored. Note-ons that are never turned off (drums, one-shots) would
+    // pile up in the checkpoints: each keeps the maxHeldNotes most recent,
+    // no Sequencer plays more voices than that (maxPolyphony). The pre-on
+    // note-offs are paired against all of them.
+    struct Checkpoint {
+        uint32_t index;
+        uint32_t heldBegin, heldEnd;
+        uint32_t preOnBegin, preOnEnd;
     };
-    std::vector<Tempo> tempos; // For normal sequence
-    std::vector<Tempo> temposPreOnOff; // For preOnOff sequence (independent context)
-    std::unique_ptr<uint8_t []> binary_data;
+    std::vector<Checkpoint> checkpoints;
+    std::vector<uint32_t> checkpointHeld;
+    static constexpr size_t maxHeldNotes = 1024;
+    void buildCheckpoints(void);
+    size_t findEvent(int32_t time) const;
+    int32_t updateHeld(std::vector<uint32_t>& held, size_t index, bool firstMatch) const;
+    void heldBefore(size_t index, std::vector<uint32_t>& held, bool forPreOnOff) const;
+    Note makeNote(const TimelineEvent& event) const;
+
+    // the file image, valid while load() decodes it: a mapped file or the caller's bytes
+    const uint8_t *image = nullptr;
     float preOnTime = 0.0f; // Pre-on signal time in milliseconds (0 = disabled)
 public:
     size_t filesize = 0;
     SMFParser();
     ~SMFParser();
+    // moved, not copied: a decoded song is swapped into the Sequencer
+    SMFParser(SMFParser&&) = default;
+    SMFParser& operator=(SMFParser&&) = default;
     bool load(const char*);
-    bool load(const godot::String &);
+    bool load(const uint8_t*, size_t);
     void unload(void);
     void restart(void);
     Note parse(int32_t, bool forPreOnOff = false);
@@ -138,4 +161,15 @@ public:
     void setPreOnTime(float pTime) { preOnTime = pTime; }
     float getPreOnTime() const { return preOnTime; }
     uint32_t getNumOfTracks() const { return numOfTracks; }
+    size_t getNumOfEvents() const { return timeline.size(); }
+
+    static constexpr int32_t checkpointInterval = 1000; // ms
+    // Moves both sequences to 'time' ms of the song (without the pre-on delay)
+    // and returns the clamped time. 'held' gets the notes sounding there and
+    // 'heldPreOnOff' those of the pre-on sequence, which is preOnTime ahead;
+    // their startTime is left to the caller.
+    int32_t seek(int32_t time, std::vector<Note>& held, std::vector<Note>& heldPreOnOff);
+    // The note-ons the pre-on sequence has parsed and not turned off yet.
+    void getHeldPreOnOff(std::vector<Note>& held) const;
+    int32_t getLength() const { return timeline.empty() ? 0 : timeline.back().time; }
 };
@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  spsc_ring.hpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded lock-free ring for exactly one producer thread and one consumer
+// thread. The capacity is rounded up to a power of two; the read and write
+// counters run freely and are masked on access, so the full capacity is
+// usable. Each side owns one counter and only reads the other one.
+template <typename T>
+class SpscRing {
+public:
+    SpscRing() = default;
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    // Not thread-safe: call while neither side is running.
+    void reset(size_t minCapacity) {
+        size_t size = 1;
+        while (size < minCapacity) size <<= 1;
+        buffer = std::make_unique<T[]>(size);
+        capacity = size;
+        mask = size - 1;
+        writePos.store(0, std::memory_order_relaxed);
+        readPos.store(0, std::memory_order_relaxed);
+    }
+
+    size_t getCapacity() const { return capacity; }
+
+    // entries the consumer can read (exact from the consumer, a lower bound elsewhere)
+    size_t readAvailable() const {
+        return (size_t)(writePos.load(std::memory_order_acquire) - readPos.load(std::memory_order_relaxed));
+    }
+    // entries the producer can write (exact from the producer, a lower bound elsewhere)
+    size_t writeAvailable() const {
+        return capacity - (size_t)(writePos.load(std::memory_order_relaxed) - readPos.load(std::memory_order_acquire));
+    }
+
+    // producer side: copies up to 'count' entries, returns how many fit
+    size_t write(const T *data, size_t count) {
+        const uint64_t w = writePos.load(std::memory_order_relaxed);
+        const uint64_t r = readPos.load(std::memory_order_acquire);
+        const size_t n = std::min(count, capacity - (size_t)(w - r));
+        for (size_t i = 0; i < n; i++) {
+            buffer[(w + i) & mask] = data[i];
+        }
+        writePos.store(w + n, std::memory_order_release);
+        return n;
+    }
+    bool push(const T &value) { return write(&value, 1) == 1; }
+
+    // consumer side: copies up to 'count' entries, returns how many were read
+    size_t read(T *data, size_t count) {
+        const uint64_t r = readPos.load(std::memory_order_relaxed);
+        const uint64_t w = writePos.load(std::memory_order_acquire);
+        const size_t n = std::min(count, (size_t)(w - r));
+        for (size_t i = 0; i < n; i++) {
+            data[i] = buffer[(r + i) & mask];
+        }
+        readPos.store(r + n, std::memory_order_release);
+        return n;
+    }
+    // consumer side: the oldest entry, or nullptr when empty
+    const T *peek() const {
+        const uint64_t r = readPos.load(std::memory_order_relaxed);
+        if (writePos.load(std::memory_order_acquire) == r) return nullptr;
+        return &buffer[r & mask];
+    }
+    void pop() {
+        readPos.store(readPos.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    std::unique_ptr<T[]> buffer;
+    size_t capacity = 0;
+    size_t mask = 0;
+    // separate cache lines so the two sides do not invalidate each other
+    alignas(64) std::atomic<uint64_t> writePos{0};
+    alignas(64) std::atomic<uint64_t> readPos{0};
+};
+
+#endif // SPSC_RING_H
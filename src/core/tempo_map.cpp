@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  tempo_map.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tempo_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+void TempoMap::clear(void) {
+    segments.clear();
+}
+
+
+void TempoMap::add(uint32_t tick, uint32_t usPerQuarter) {
+    if (usPerQuarter == 0) return;
+    segments.push_back({tick, usPerQuarter, 0});
+}
+
+
+void TempoMap::build(uint32_t timeDivision) {
+    division = timeDivision ? timeDivision : 480;
+
+    std::stable_sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) {
+        return a.tick < b.tick;
+    });
+    // keep the last change of each tick
+    std::vector<Segment> merged;
+    merged.reserve(segments.size() + 1);
+    if (segments.empty() || segments.front().tick != 0) {
+        merged.push_back({0, defaultTempo, 0});
+    }
+    for (const Segment& segment : segments) {
+        if (!merged.empty() && merged.back().tick == segment.tick) merged.back() = segment;
+        else merged.push_back(segment);
+    }
+
+    int64_t elapsed = 0;
+    for (size_t i = 0; i < merged.size(); ++i) {
+        if (i > 0) elapsed += (int64_t)(merged[i].tick - merged[i - 1].tick) * merged[i - 1].usPerQuarter;
+        merged[i].elapsed = elapsed;
+    }
+    segments.swap(merged);
+}
+
+
+const TempoMap::Segment& TempoMap::find(uint32_t tick) const {
+    // last segment starting at or before tick; the first one starts at 0
+    auto it = std::upper_bound(segments.begin(), segments.end(), tick, [](uint32_t t, const Segment& segment) {
+        return t < segment.tick;
+    });
+    return *(it - 1);
+}
+
+
+double TempoMap::tickToMicros(uint32_t tick) const {
+    if (segments.empty()) return (double)tick * defaultTempo / division;
+    const Segment& segment = find(tick);
+    const int64_t elapsed = segment.elapsed + (int64_t)(tick - segment.tick) * segment.usPerQuarter;
+    return (double)elapsed / division;
+}
+
+
+uint32_t TempoMap::microsToTick(double micros) const {
+    if (micros <= 0.0) return 0;
+    const double scaled = micros * division;
+    if (segments.empty()) return (uint32_t)std::min(scaled / defaultTempo, 4294967295.0);
+    auto it = std::upper_bound(segments.begin(), segments.end(), scaled, [](double s, const Segment& segment) {
+        return s < (double)segment.elapsed;
+    });
+    const Segment& segment = *(it - 1);
+    const double tick = segment.tick + (scaled - (double)segment.elapsed) / segment.usPerQuarter;
+    return (uint32_t)std::min(tick, 4294967295.0);
+}
+
+
+uint32_t TempoMap::getTempo(uint32_t tick) const {
+    return segments.empty() ? defaultTempo : find(tick).usPerQuarter;
+}
+
+
+int32_t TempoMap::getBPM(uint32_t tick) const {
+    return (int32_t)std::lround(60000000.0 / getTempo(tick));
+}
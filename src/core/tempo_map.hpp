@@ -0,0 +1,67 @@
+/**************************************************************************/
+/*  tempo_map.hpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEMPO_MAP_H
+#define TEMPO_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Tick <-> time conversion of an SMF. The tempo changes are sorted once and
+// every segment keeps the time elapsed before it as an exact integer sum of
+// ticks * microseconds per quarter, so a query is one binary search and no
+// rounding accumulates over the song.
+class TempoMap {
+public:
+    static constexpr uint32_t defaultTempo = 1000000; // us per quarter note (60 BPM)
+
+    // Not thread-safe. Changes at the same tick: the last one added wins.
+    void clear(void);
+    void add(uint32_t tick, uint32_t usPerQuarter);
+    void build(uint32_t timeDivision);
+
+    double tickToMicros(uint32_t tick) const;
+    uint32_t microsToTick(double micros) const;
+    uint32_t getTempo(uint32_t tick) const;     // us per quarter note
+    int32_t getBPM(uint32_t tick) const;
+    size_t getNumOfChanges() const { return segments.size(); }
+
+private:
+    struct Segment {
+        uint32_t tick;
+        uint32_t usPerQuarter;
+        int64_t elapsed; // sum of ticks * usPerQuarter before this segment
+    };
+    std::vector<Segment> segments;
+    uint32_t division = 480;
+
+    const Segment& find(uint32_t tick) const;
+};
+
+#endif // TEMPO_MAP_H
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  voice_kernel.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "voice_kernel.hpp"
+#include <algorithm>
+#include <cmath>
+
+static bool cpuSupports(RenderKernel kernel) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    switch (kernel) {
+        case RenderKernel::RK_SSE2:   return __builtin_cpu_supports("sse2");
+        case RenderKernel::RK_AVX2:   return __builtin_cpu_supports("avx2");
+        case RenderKernel::RK_AVX512: return __builtin_cpu_supports("avx512f");
+        default: break;
+    }
+#endif
+    return true; // non-x86 kernels are compile-time only
+}
+
+static const VoiceKernel* getVoiceKernel(RenderKernel kernel) {
+    const VoiceKernel* found = nullptr;
+    switch (kernel) {
+        case RenderKernel::RK_SSE2:    found = getVoiceKernelSSE2(); break;
+        case RenderKernel::RK_AVX2:    found = getVoiceKernelAVX2(); break;
+        case RenderKernel::RK_AVX512:  found = getVoiceKernelAVX512(); break;
+        case RenderKernel::RK_SIMD128: found = getVoiceKernelSIMD128(); break;
+        case RenderKernel::RK_GENERIC: found = getVoiceKernelGeneric(); break;
+        default: break;
+    }
+    if (found != nullptr && !cpuSupports(kernel)) found = nullptr;
+    return found;
+}
+
+const VoiceKernel* selectVoiceKernel(RenderKernel requested) {
+    if (requested == RenderKernel::RK_SCALAR) return nullptr;
+    if (requested != RenderKernel::RK_AUTO) return getVoiceKernel(requested);
+
+    // widest first
+    static const RenderKernel preference[] = {
+        RenderKernel::RK_AVX512,
+        RenderKernel::RK_AVX2,
+        RenderKernel::RK_SSE2,
+        RenderKernel::RK_SIMD128,
+        RenderKernel::RK_GENERIC,
+    };
+    for (RenderKernel kernel : preference) {
+        const VoiceKernel* found = getVoiceKernel(kernel);
+        if (found != nullptr) return found;
+    }
+    return nullptr;
+}
+
+const char* getRenderKernelName(RenderKernel kernel) {
+    switch (kernel) {
+        case RenderKernel::RK_AUTO:    return "auto";
+        case RenderKernel::RK_SCALAR:  return "scalar";
+        case RenderKernel::RK_SSE2:    return "sse2";
+        case RenderKernel::RK_AVX2:    return "avx2";
+        case RenderKernel::RK_AVX512:  return "avx512";
+        case RenderKernel::RK_SIMD128: return "simd128";
+        case RenderKernel::RK_GENERIC: return "generic";
+        default: break;
+    }
+    return "unknown";
+}
+
+
+float masterStageScalar(float* frame, int32_t numSamples, float knee) {
+    float peak = 0.0f;
+    if (knee < 1.0f) {
+        const float range = 1.0f - knee;
+        const float invRange = 1.0f / range;
+        for (int32_t i = 0; i < numSamples; i++) {
+            const float x = frame[i];
+            peak = std::max(peak, std::fabs(x));
+            const float overHi = std::max(x - knee, 0.0f) * invRange;
+            const float overLo = std::max(-knee - x, 0.0f) * invRange;
+            const float soft = overHi / (1.0f + overHi) - overLo / (1.0f + overLo);
+            frame[i] = std::clamp(x, -knee, knee) + range * soft;
+        }
+    } else {
+        for (int32_t i = 0; i < numSamples; i++) {
+            peak = std::max(peak, std::fabs(frame[i]));
+            frame[i] = std::clamp(frame[i], -1.0f, 1.0f);
+        }
+    }
+    return peak;
+}
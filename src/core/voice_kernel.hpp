@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  voice_kernel.hpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef VOICE_KERNEL_H
+#define VOICE_KERNEL_H
+
+#include <cstdint>
+
+// Lane-parallel oscillator kernel.
+//
+// Sequencer::feed() renders the active tones in groups of VoiceKernel::width
+// tones. Envelope, LFOs and pitch are evaluated per tone by the scalar control
+// stage, which writes per-sample phase increments and gains in sample-major
+// order ([sample * width + lane]). The kernel then advances the three
+// oscillator phases of all lanes at once, gathers the wave tables, applies the
+// key-tracked sine/base blend, low frequency correction, noise mix and gain, and
+// writes one output sample per lane. Nothing is clipped per voice; the summed
+// frame goes through a single master stage (limiter and peak meter) per buffer.
+//
+// Each instruction set lives in its own translation unit (voice_kernel_*.cpp)
+// that is compiled with the matching flags; selectVoiceKernel() picks the best
+// one the running CPU supports.
+
+enum class RenderKernel {
+    RK_AUTO,      //  0: best available kernel
+    RK_SCALAR,    //  1: reference per-tone loop (no lane kernel)
+    RK_SSE2,      //  2: 4 lanes
+    RK_AVX2,      //  3: 8 lanes
+    RK_AVX512,    //  4: 16 lanes
+    RK_SIMD128,   //  5: 4 lanes, WebAssembly
+    RK_GENERIC,   //  6: 4 lanes, portable C++
+
+    RK_TAIL
+};
+
+struct VoiceLaneBlock {
+    // per sample and lane, [sample * width + lane]
+    const float* inc1;
+    const float* inc2;
+    const float* inc3;
+    const float* gain;
+    float* out;
+
+    // per lane (width entries)
+    float* phase1;
+    float* phase2;
+    float* phase3;
+    const int32_t* waveOffset1; // first entry of the voice's mip level in waveTable
+    const int32_t* waveOffset2;
+    const int32_t* waveOffset3;
+    const int32_t* waveMask1;   // mip level size - 1
+    const int32_t* waveMask2;
+    const int32_t* waveMask3;
+    const float* waveScale1;    // phase (rad) -> mip level index
+    const float* waveScale2;
+    const float* waveScale3;
+    const float* baseRatio1;
+    const float* baseRatio2;
+    const float* baseRatio3;
+    const float* noiseRatio;
+    const float* noisePink;     // 0: white noise, 1: pink noise
+
+    // shared by all lanes
+    const float* waveTable;     // SharedLUT::getWaveMipLUT()
+    const float* lfcTable;      // low frequency correction, indexed by Hz >> 3
+    const float* whiteNoise;    // numSamples entries from the block start
+    const float* pinkNoise;
+    float freqScale;            // phase increment -> Hz
+    int32_t numSamples;
+};
+
+struct VoiceKernel {
+    static constexpr int32_t maxWidth = 16;
+    RenderKernel id;
+    const char* name;
+    int32_t width;
+    void (*render)(const VoiceLaneBlock&);
+    // frame[i] += sum of the 'width' lanes of row i
+    void (*mix)(const float* lanes, int32_t numSamples, float* frame);
+    // limits frame in place, returns the peak before limiting
+    float (*master)(float* frame, int32_t numSamples, float knee);
+};
+
+// Master stage of the scalar path and for the kernels' remainder samples.
+// knee >= 1.0 clips hard at full scale. Below 1.0, the signal is linear up to
+// 'knee' and above it approaches full scale along knee + (1-knee)*k/(1+k),
+// k = (|x|-knee)/(1-knee). Returns the peak absolute value before limiting.
+float masterStageScalar(float* frame, int32_t numSamples, float knee);
+
+// Returns nullptr when the requested kernel is not compiled in or not supported
+// by this CPU; the caller then uses the scalar reference path.
+const VoiceKernel* selectVoiceKernel(RenderKernel requested);
+const char* getRenderKernelName(RenderKernel kernel);
+
+// Per instruction set entry points (nullptr when not compiled in).
+const VoiceKernel* getVoiceKernelSSE2();
+const VoiceKernel* getVoiceKernelAVX2();
+const VoiceKernel* getVoiceKernelAVX512();
+const VoiceKernel* getVoiceKernelSIMD128();
+const VoiceKernel* getVoiceKernelGeneric();
+
+#endif // VOICE_KERNEL_H
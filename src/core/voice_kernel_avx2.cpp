@@ -0,0 +1,92 @@
+/**************************************************************************/
+/*  voice_kernel_avx2.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// AVX2 lanes (8 tones) with hardware gathers. Built with -mavx2 on x86_64 and
+// only selected when the CPU reports AVX2.
+
+#include "voice_kernel.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#include "voice_kernel_impl.hpp"
+
+namespace {
+
+struct LanesAVX2 {
+    using F = __m256;
+    using I = __m256i;
+    static constexpr int32_t width = 8;
+
+    static F load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, F v) { _mm256_storeu_ps(p, v); }
+    static F set1(float v) { return _mm256_set1_ps(v); }
+    static I loadi(const int32_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+    static I set1i(int32_t v) { return _mm256_set1_epi32(v); }
+
+    static F add(F a, F b) { return _mm256_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static F div(F a, F b) { return _mm256_div_ps(a, b); }
+    static F min(F a, F b) { return _mm256_min_ps(a, b); }
+    static F max(F a, F b) { return _mm256_max_ps(a, b); }
+    static F wrap(F ph, F twoPi) { return _mm256_sub_ps(ph, _mm256_and_ps(_mm256_cmp_ps(ph, twoPi, _CMP_GT_OQ), twoPi)); }
+
+    static I cvtt(F v) { return _mm256_cvttps_epi32(v); }
+    static F cvtf(I v) { return _mm256_cvtepi32_ps(v); }
+    static I andi(I a, I b) { return _mm256_and_si256(a, b); }
+    static I addi(I a, I b) { return _mm256_add_epi32(a, b); }
+    template <int N>
+    static I srai(I a) { return _mm256_srai_epi32(a, N); }
+
+    static F gather(const float *base, I idx) { return _mm256_i32gather_ps(base, idx, 4); }
+    static float hsum(F v) {
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+        return _mm_cvtss_f32(s);
+    }
+};
+
+void renderAVX2(const VoiceLaneBlock &b) { renderVoiceLanes<LanesAVX2>(b); }
+void mixAVX2(const float *lanes, int32_t n, float *frame) { mixVoiceLanes<LanesAVX2>(lanes, n, frame); }
+float masterAVX2(float *frame, int32_t n, float knee) { return masterStageLanes<LanesAVX2>(frame, n, knee); }
+
+} // namespace
+
+const VoiceKernel* getVoiceKernelAVX2() {
+    static const VoiceKernel kernel = {RenderKernel::RK_AVX2, "avx2", LanesAVX2::width, renderAVX2, mixAVX2, masterAVX2};
+    return &kernel;
+}
+
+#else
+
+const VoiceKernel* getVoiceKernelAVX2() {
+    return nullptr;
+}
+
+#endif // __AVX2__
@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*  voice_kernel_avx512.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// AVX-512F lanes (16 tones). Built with -mavx512f on x86_64 and only selected
+// when the CPU reports AVX-512F.
+
+#include "voice_kernel.hpp"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#include "voice_kernel_impl.hpp"
+
+namespace {
+
+struct LanesAVX512 {
+    using F = __m512;
+    using I = __m512i;
+    static constexpr int32_t width = 16;
+
+    static F load(const float *p) { return _mm512_loadu_ps(p); }
+    static void store(float *p, F v) { _mm512_storeu_ps(p, v); }
+    static F set1(float v) { return _mm512_set1_ps(v); }
+    static I loadi(const int32_t *p) { return _mm512_loadu_si512((const void *)p); }
+    static I set1i(int32_t v) { return _mm512_set1_epi32(v); }
+
+    static F add(F a, F b) { return _mm512_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm512_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm512_mul_ps(a, b); }
+    static F div(F a, F b) { return _mm512_div_ps(a, b); }
+    static F min(F a, F b) { return _mm512_min_ps(a, b); }
+    static F max(F a, F b) { return _mm512_max_ps(a, b); }
+    static F wrap(F ph, F twoPi) { return _mm512_mask_sub_ps(ph, _mm512_cmp_ps_mask(ph, twoPi, _CMP_GT_OQ), ph, twoPi); }
+
+    static I cvtt(F v) { return _mm512_cvttps_epi32(v); }
+    static F cvtf(I v) { return _mm512_cvtepi32_ps(v); }
+    static I andi(I a, I b) { return _mm512_and_si512(a, b); }
+    static I addi(I a, I b) { return _mm512_add_epi32(a, b); }
+    template <int N>
+    static I srai(I a) { return _mm512_srai_epi32(a, N); }
+
+    static F gather(const float *base, I idx) { return _mm512_i32gather_ps(idx, base, 4); }
+    static float hsum(F v) { return _mm512_reduce_add_ps(v); }
+};
+
+void renderAVX512(const VoiceLaneBlock &b) { renderVoiceLanes<LanesAVX512>(b); }
+void mixAVX512(const float *lanes, int32_t n, float *frame) { mixVoiceLanes<LanesAVX512>(lanes, n, frame); }
+float masterAVX512(float *frame, int32_t n, float knee) { return masterStageLanes<LanesAVX512>(frame, n, knee); }
+
+} // namespace
+
+const VoiceKernel* getVoiceKernelAVX512() {
+    static const VoiceKernel kernel = {RenderKernel::RK_AVX512, "avx512", LanesAVX512::width, renderAVX512, mixAVX512, masterAVX512};
+    return &kernel;
+}
+
+#else
+
+const VoiceKernel* getVoiceKernelAVX512() {
+    return nullptr;
+}
+
+#endif // __AVX512F__
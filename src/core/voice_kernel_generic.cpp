@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  voice_kernel_generic.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Portable lanes (4 tones) in plain C++, for targets without a SIMD kernel
+// (e.g. web builds without simd128). Keeps the lane path, and with it the
+// control-rate option, available everywhere; the compiler may still
+// vectorize the fixed-size loops.
+
+#include "voice_kernel.hpp"
+#include "voice_kernel_impl.hpp"
+
+namespace {
+
+struct LanesGeneric {
+    static constexpr int32_t width = 4;
+    struct F { float v[width]; };
+    struct I { int32_t v[width]; };
+
+    template <typename Op>
+    static F map(F a, F b, Op op) {
+        F r;
+        for (int32_t k = 0; k < width; k++) r.v[k] = op(a.v[k], b.v[k]);
+        return r;
+    }
+    template <typename Op>
+    static I mapi(I a, I b, Op op) {
+        I r;
+        for (int32_t k = 0; k < width; k++) r.v[k] = op(a.v[k], b.v[k]);
+        return r;
+    }
+
+    static F load(const float *p) { F r; for (int32_t k = 0; k < width; k++) r.v[k] = p[k]; return r; }
+    static void store(float *p, F v) { for (int32_t k = 0; k < width; k++) p[k] = v.v[k]; }
+    static F set1(float v) { F r; for (int32_t k = 0; k < width; k++) r.v[k] = v; return r; }
+    static I loadi(const int32_t *p) { I r; for (int32_t k = 0; k < width; k++) r.v[k] = p[k]; return r; }
+    static I set1i(int32_t v) { I r; for (int32_t k = 0; k < width; k++) r.v[k] = v; return r; }
+
+    static F add(F a, F b) { return map(a, b, [](float x, float y) { return x + y; }); }
+    static F sub(F a, F b) { return map(a, b, [](float x, float y) { return x - y; }); }
+    static F mul(F a, F b) { return map(a, b, [](float x, float y) { return x * y; }); }
+    static F div(F a, F b) { return map(a, b, [](float x, float y) { return x / y; }); }
+    static F min(F a, F b) { return map(a, b, [](float x, float y) { return (y < x) ? y : x; }); }
+    static F max(F a, F b) { return map(a, b, [](float x, float y) { return (x < y) ? y : x; }); }
+    static F wrap(F ph, F twoPi) { return map(ph, twoPi, [](float x, float y) { return (x > y) ? x - y : x; }); }
+
+    static I cvtt(F v) { I r; for (int32_t k = 0; k < width; k++) r.v[k] = (int32_t)v.v[k]; return r; }
+    static F cvtf(I v) { F r; for (int32_t k = 0; k < width; k++) r.v[k] = (float)v.v[k]; return r; }
+    static I andi(I a, I b) { return mapi(a, b, [](int32_t x, int32_t y) { return x & y; }); }
+    static I addi(I a, I b) { return mapi(a, b, [](int32_t x, int32_t y) { return x + y; }); }
+    template <int N>
+    static I srai(I a) { I r; for (int32_t k = 0; k < width; k++) r.v[k] = a.v[k] >> N; return r; }
+
+    static F gather(const float *base, I idx) { F r; for (int32_t k = 0; k < width; k++) r.v[k] = base[idx.v[k]]; return r; }
+    static float hsum(F v) { return (v.v[0] + v.v[2]) + (v.v[1] + v.v[3]); }
+};
+
+void renderGeneric(const VoiceLaneBlock &b) { renderVoiceLanes<LanesGeneric>(b); }
+void mixGeneric(const float *lanes, int32_t n, float *frame) { mixVoiceLanes<LanesGeneric>(lanes, n, frame); }
+float masterGeneric(float *frame, int32_t n, float knee) { return masterStageLanes<LanesGeneric>(frame, n, knee); }
+
+} // namespace
+
+const VoiceKernel* getVoiceKernelGeneric() {
+    static const VoiceKernel kernel = {RenderKernel::RK_GENERIC, "generic", LanesGeneric::width, renderGeneric, mixGeneric, masterGeneric};
+    return &kernel;
+}
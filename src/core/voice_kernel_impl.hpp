@@ -0,0 +1,175 @@
+/**************************************************************************/
+/*  voice_kernel_impl.hpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef VOICE_KERNEL_IMPL_H
+#define VOICE_KERNEL_IMPL_H
+
+#include "voice_kernel.hpp"
+#include <algorithm>
+
+// Kernel body shared by all instruction sets. Included only by the
+// voice_kernel_*.cpp files; 'L' supplies the vector types and operations:
+//   F, I, width, load/store/set1, loadi/set1i, add/sub/mul/div/min/max,
+//   wrap (subtract 2pi where above 2pi), cvtt, cvtf, andi, addi, srai<N>,
+//   gather, hsum
+
+// Linear interpolation in the lanes' mip levels. Each level ends with a copy of
+// its first entry, so index + 1 needs no second mask.
+template <typename L>
+static inline typename L::F waveLookup(const float *table, typename L::F ph, typename L::F scale,
+                                       typename L::I mask, typename L::I offset, typename L::I one) {
+    const typename L::F pos = L::mul(ph, scale);
+    const typename L::I index = L::cvtt(pos);
+    const typename L::F frac = L::sub(pos, L::cvtf(index));
+    const typename L::I entry = L::addi(L::andi(index, mask), offset);
+    const typename L::F a = L::gather(table, entry);
+    const typename L::F b = L::gather(table, L::addi(entry, one));
+    return L::add(a, L::mul(L::sub(b, a), frac));
+}
+
+template <typename L>
+static void renderVoiceLanes(const VoiceLaneBlock &b) {
+    using F = typename L::F;
+    using I = typename L::I;
+    constexpr int32_t W = L::width;
+
+    const F twoPi = L::set1(2.0f * 3.1415926535897932384626433833f);
+    const F freqScale = L::set1(b.freqScale);
+    const F one = L::set1(1.0f);
+    const I onei = L::set1i(1);
+
+    const I waveOffset1 = L::loadi(b.waveOffset1);
+    const I waveOffset2 = L::loadi(b.waveOffset2);
+    const I waveOffset3 = L::loadi(b.waveOffset3);
+    const I waveMask1 = L::loadi(b.waveMask1);
+    const I waveMask2 = L::loadi(b.waveMask2);
+    const I waveMask3 = L::loadi(b.waveMask3);
+    const F waveScale1 = L::load(b.waveScale1);
+    const F waveScale2 = L::load(b.waveScale2);
+    const F waveScale3 = L::load(b.waveScale3);
+    const F baseRatio1 = L::load(b.baseRatio1);
+    const F baseRatio2 = L::load(b.baseRatio2);
+    const F baseRatio3 = L::load(b.baseRatio3);
+    const F noiseRatio = L::load(b.noiseRatio);
+    const F toneRatio = L::sub(one, noiseRatio);
+    const F noisePink = L::load(b.noisePink);
+
+    F ph1 = L::load(b.phase1);
+    F ph2 = L::load(b.phase2);
+    F ph3 = L::load(b.phase3);
+
+    for (int32_t i = 0; i < b.numSamples; i++) {
+        const int32_t row = i * W;
+        const F inc1 = L::load(b.inc1 + row);
+        const F inc2 = L::load(b.inc2 + row);
+        const F inc3 = L::load(b.inc3 + row);
+
+        // phase advance
+        ph1 = L::wrap(L::add(ph1, inc1), twoPi);
+        ph2 = L::wrap(L::add(ph2, inc2), twoPi);
+        ph3 = L::wrap(L::add(ph3, inc3), twoPi);
+
+        // band-limited wave of each lane's mip level, oscillator ratio
+        F tone1 = L::mul(waveLookup<L>(b.waveTable, ph1, waveScale1, waveMask1, waveOffset1, onei), baseRatio1);
+        F tone2 = L::mul(waveLookup<L>(b.waveTable, ph2, waveScale2, waveMask2, waveOffset2, onei), baseRatio2);
+        F tone3 = L::mul(waveLookup<L>(b.waveTable, ph3, waveScale3, waveMask3, waveOffset3, onei), baseRatio3);
+
+        // low frequency correction
+        tone1 = L::mul(tone1, L::gather(b.lfcTable, L::template srai<3>(L::cvtt(L::mul(inc1, freqScale)))));
+        tone2 = L::mul(tone2, L::gather(b.lfcTable, L::template srai<3>(L::cvtt(L::mul(inc2, freqScale)))));
+        tone3 = L::mul(tone3, L::gather(b.lfcTable, L::template srai<3>(L::cvtt(L::mul(inc3, freqScale)))));
+
+        F data = L::add(L::add(tone1, tone2), tone3);
+
+        // noise mix
+        const F white = L::set1(b.whiteNoise[i]);
+        const F noise = L::add(white, L::mul(L::sub(L::set1(b.pinkNoise[i]), white), noisePink));
+        data = L::add(L::mul(data, toneRatio), L::mul(noise, noiseRatio));
+
+        // gain, no clipping until the master stage
+        L::store(b.out + row, L::mul(data, L::load(b.gain + row)));
+    }
+
+    L::store(b.phase1, ph1);
+    L::store(b.phase2, ph2);
+    L::store(b.phase3, ph3);
+}
+
+template <typename L>
+static void mixVoiceLanes(const float *lanes, int32_t numSamples, float *frame) {
+    for (int32_t i = 0; i < numSamples; i++) {
+        frame[i] += L::hsum(L::load(lanes + i * L::width));
+    }
+}
+
+// Master stage, see masterStageScalar() in voice_kernel.cpp for the curve.
+template <typename L>
+static float masterStageLanes(float *frame, int32_t numSamples, float knee) {
+    using F = typename L::F;
+    constexpr int32_t W = L::width;
+    const F zero = L::set1(0.0f);
+    const F one = L::set1(1.0f);
+    const F minusOne = L::set1(-1.0f);
+    const F kneeHi = L::set1(knee);
+    const F kneeLo = L::set1(-knee);
+    const F range = L::set1(1.0f - knee);
+    const F invRange = L::set1((knee < 1.0f) ? 1.0f / (1.0f - knee) : 0.0f);
+    F peakHi = zero;
+    F peakLo = zero;
+    int32_t i = 0;
+    for (; i + W <= numSamples; i += W) {
+        const F x = L::load(frame + i);
+        peakHi = L::max(peakHi, x);
+        peakLo = L::min(peakLo, x);
+        F y;
+        if (knee < 1.0f) {
+            const F overHi = L::mul(L::max(L::sub(x, kneeHi), zero), invRange);
+            const F overLo = L::mul(L::max(L::sub(kneeLo, x), zero), invRange);
+            const F soft = L::sub(L::div(overHi, L::add(one, overHi)), L::div(overLo, L::add(one, overLo)));
+            y = L::add(L::max(L::min(x, kneeHi), kneeLo), L::mul(range, soft));
+        } else {
+            y = L::max(L::min(x, one), minusOne);
+        }
+        L::store(frame + i, y);
+    }
+    alignas(64) float hi[W];
+    alignas(64) float lo[W];
+    L::store(hi, peakHi);
+    L::store(lo, peakLo);
+    float peak = 0.0f;
+    for (int32_t k = 0; k < W; k++) {
+        peak = std::max(peak, std::max(hi[k], -lo[k]));
+    }
+    if (i < numSamples) {
+        peak = std::max(peak, masterStageScalar(frame + i, numSamples - i, knee));
+    }
+    return peak;
+}
+
+#endif // VOICE_KERNEL_IMPL_H
@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  voice_kernel_simd128.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// WebAssembly SIMD128 lanes (4 tones). WebAssembly has no runtime feature
+// detection, so this is only compiled in when the web build enables -msimd128.
+
+#include "voice_kernel.hpp"
+
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#include "voice_kernel_impl.hpp"
+
+namespace {
+
+struct LanesSIMD128 {
+    using F = v128_t;
+    using I = v128_t;
+    static constexpr int32_t width = 4;
+
+    static F load(const float *p) { return wasm_v128_load(p); }
+    static void store(float *p, F v) { wasm_v128_store(p, v); }
+    static F set1(float v) { return wasm_f32x4_splat(v); }
+    static I loadi(const int32_t *p) { return wasm_v128_load(p); }
+    static I set1i(int32_t v) { return wasm_i32x4_splat(v); }
+
+    static F add(F a, F b) { return wasm_f32x4_add(a, b); }
+    static F sub(F a, F b) { return wasm_f32x4_sub(a, b); }
+    static F mul(F a, F b) { return wasm_f32x4_mul(a, b); }
+    static F div(F a, F b) { return wasm_f32x4_div(a, b); }
+    static F min(F a, F b) { return wasm_f32x4_pmin(a, b); }
+    static F max(F a, F b) { return wasm_f32x4_pmax(a, b); }
+    static F wrap(F ph, F twoPi) { return wasm_f32x4_sub(ph, wasm_v128_and(wasm_f32x4_gt(ph, twoPi), twoPi)); }
+
+    static I cvtt(F v) { return wasm_i32x4_trunc_sat_f32x4(v); }
+    static F cvtf(I v) { return wasm_f32x4_convert_i32x4(v); }
+    static I andi(I a, I b) { return wasm_v128_and(a, b); }
+    static I addi(I a, I b) { return wasm_i32x4_add(a, b); }
+    template <int N>
+    static I srai(I a) { return wasm_i32x4_shr(a, N); }
+
+    static F gather(const float *base, I idx) {
+        return wasm_f32x4_make(base[wasm_i32x4_extract_lane(idx, 0)], base[wasm_i32x4_extract_lane(idx, 1)],
+                               base[wasm_i32x4_extract_lane(idx, 2)], base[wasm_i32x4_extract_lane(idx, 3)]);
+    }
+    static float hsum(F v) {
+        return (wasm_f32x4_extract_lane(v, 0) + wasm_f32x4_extract_lane(v, 2))
+             + (wasm_f32x4_extract_lane(v, 1) + wasm_f32x4_extract_lane(v, 3));
+    }
+};
+
+void renderSIMD128(const VoiceLaneBlock &b) { renderVoiceLanes<LanesSIMD128>(b); }
+void mixSIMD128(const float *lanes, int32_t n, float *frame) { mixVoiceLanes<LanesSIMD128>(lanes, n, frame); }
+float masterSIMD128(float *frame, int32_t n, float knee) { return masterStageLanes<LanesSIMD128>(frame, n, knee); }
+
+} // namespace
+
+const VoiceKernel* getVoiceKernelSIMD128() {
+    static const VoiceKernel kernel = {RenderKernel::RK_SIMD128, "simd128", LanesSIMD128::width, renderSIMD128, mixSIMD128, masterSIMD128};
+    return &kernel;
+}
+
+#else
+
+const VoiceKernel* getVoiceKernelSIMD128() {
+    return nullptr;
+}
+
+#endif // __wasm_simd128__
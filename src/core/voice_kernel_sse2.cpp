@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  voice_kernel_sse2.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// SSE2 lanes (4 tones). Part of the x86_64 baseline, so always compiled there.
+
+#include "voice_kernel.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#include "voice_kernel_impl.hpp"
+
+namespace {
+
+struct LanesSSE2 {
+    using F = __m128;
+    using I = __m128i;
+    static constexpr int32_t width = 4;
+
+    static F load(const float *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, F v) { _mm_storeu_ps(p, v); }
+    static F set1(float v) { return _mm_set1_ps(v); }
+    static I loadi(const int32_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+    static I set1i(int32_t v) { return _mm_set1_epi32(v); }
+
+    static F add(F a, F b) { return _mm_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static F div(F a, F b) { return _mm_div_ps(a, b); }
+    static F min(F a, F b) { return _mm_min_ps(a, b); }
+    static F max(F a, F b) { return _mm_max_ps(a, b); }
+    static F wrap(F ph, F twoPi) { return _mm_sub_ps(ph, _mm_and_ps(_mm_cmpgt_ps(ph, twoPi), twoPi)); }
+
+    static I cvtt(F v) { return _mm_cvttps_epi32(v); }
+    static F cvtf(I v) { return _mm_cvtepi32_ps(v); }
+    static I andi(I a, I b) { return _mm_and_si128(a, b); }
+    static I addi(I a, I b) { return _mm_add_epi32(a, b); }
+    template <int N>
+    static I srai(I a) { return _mm_srai_epi32(a, N); }
+
+    static F gather(const float *base, I idx) {
+        alignas(16) int32_t k[4];
+        _mm_store_si128((__m128i *)k, idx);
+        return _mm_setr_ps(base[k[0]], base[k[1]], base[k[2]], base[k[3]]);
+    }
+    static float hsum(F v) {
+        __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+        return _mm_cvtss_f32(s);
+    }
+};
+
+void renderSSE2(const VoiceLaneBlock &b) { renderVoiceLanes<LanesSSE2>(b); }
+void mixSSE2(const float *lanes, int32_t n, float *frame) { mixVoiceLanes<LanesSSE2>(lanes, n, frame); }
+float masterSSE2(float *frame, int32_t n, float knee) { return masterStageLanes<LanesSSE2>(frame, n, knee); }
+
+} // namespace
+
+const VoiceKernel* getVoiceKernelSSE2() {
+    static const VoiceKernel kernel = {RenderKernel::RK_SSE2, "sse2", LanesSSE2::width, renderSSE2, mixSSE2, masterSSE2};
+    return &kernel;
+}
+
+#else
+
+const VoiceKernel* getVoiceKernelSSE2() {
+    return nullptr;
+}
+
+#endif // __SSE2__
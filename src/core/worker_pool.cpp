@@ -0,0 +1,173 @@
+/**************************************************************************/
+/*  worker_pool.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "worker_pool.hpp"
+
+#include <algorithm>
+
+static uint64_t packRange(uint32_t begin, uint32_t end) {
+    return (uint64_t)begin | ((uint64_t)end << 32);
+}
+
+WorkerPool::~WorkerPool() {
+    stopWorkers();
+}
+
+
+void WorkerPool::setThreads(int32_t count) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    count = 1;
+#endif
+    count = std::clamp(count, 1, maxThreads);
+    if (count == threads) {
+        return;
+    }
+    stopWorkers();
+    threads = count;
+    if (threads == 1) {
+        return;
+    }
+    ranges = std::make_unique<Range[]>((size_t)threads);
+    quit = false;
+    generation = 0;
+    for (int32_t t = 1; t < threads; t++) {
+        workers.emplace_back(&WorkerPool::workerMain, this, t);
+    }
+}
+
+
+void WorkerPool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+
+void WorkerPool::dispatch(int32_t count, Invoke invoke, void *context) {
+    if (threads == 1 || count <= 1) {
+        for (int32_t i = 0; i < count; i++) {
+            invoke(context, i, 0);
+        }
+        return;
+    }
+    for (int32_t t = 0; t < threads; t++) {
+        const uint32_t begin = (uint32_t)((int64_t)count * t / threads);
+        const uint32_t end = (uint32_t)((int64_t)count * (t + 1) / threads);
+        ranges[t].bounds.store(packRange(begin, end), std::memory_order_relaxed);
+    }
+    pending.store(count, std::memory_order_relaxed);
+    busy.store(threads - 1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->invoke = invoke;
+        this->context = context;
+        generation++;
+    }
+    wake.notify_all();
+
+    work(0);
+    // the outputs of the jobs are complete once pending is 0; busy keeps the
+    // workers out of the ranges of the next run
+    while (pending.load(std::memory_order_acquire) > 0 || busy.load(std::memory_order_acquire) > 0) {
+        std::this_thread::yield();
+    }
+}
+
+
+void WorkerPool::workerMain(int32_t thread) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return quit || generation != seen; });
+            if (quit) {
+                return;
+            }
+            seen = generation;
+        }
+        work(thread);
+        busy.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+
+// Own range first, then steal from the others until every range is empty.
+void WorkerPool::work(int32_t thread) {
+    int32_t index = 0;
+    while (takeFront(thread, index)) {
+        invoke(context, index, thread);
+        pending.fetch_sub(1, std::memory_order_release);
+    }
+    for (int32_t n = 1; n < threads; n++) {
+        const int32_t victim = (thread + n) % threads;
+        while (takeBack(victim, index)) {
+            invoke(context, index, thread);
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+}
+
+
+bool WorkerPool::takeFront(int32_t thread, int32_t &index) {
+    std::atomic<uint64_t> &bounds = ranges[thread].bounds;
+    uint64_t value = bounds.load(std::memory_order_relaxed);
+    while (true) {
+        const uint32_t begin = (uint32_t)value;
+        const uint32_t end = (uint32_t)(value >> 32);
+        if (begin >= end) {
+            return false;
+        }
+        if (bounds.compare_exchange_weak(value, packRange(begin + 1, end), std::memory_order_acq_rel)) {
+            index = (int32_t)begin;
+            return true;
+        }
+    }
+}
+
+
+bool WorkerPool::takeBack(int32_t victim, int32_t &index) {
+    std::atomic<uint64_t> &bounds = ranges[victim].bounds;
+    uint64_t value = bounds.load(std::memory_order_relaxed);
+    while (true) {
+        const uint32_t begin = (uint32_t)value;
+        const uint32_t end = (uint32_t)(value >> 32);
+        if (begin >= end) {
+            return false;
+        }
+        if (bounds.compare_exchange_weak(value, packRange(begin, end - 1), std::memory_order_acq_rel)) {
+            index = (int32_t)(end - 1);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  worker_pool.hpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GDSynthesizer                              */
+/**************************************************************************/
+/* Copyright (c) 2023-2024 Soyo Kuyo.                                     */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small work-stealing pool for the voice groups of one render block.
+//
+// run() splits the job indices into one contiguous range per thread (the
+// calling thread is thread 0 and works too). Each thread takes jobs from the
+// front of its own range; a thread whose range is empty steals single jobs
+// from the back of the others', so a thread that got the expensive voices is
+// helped by the rest. Which thread runs a job is not deterministic: jobs must
+// write to their own outputs and leave the reduction to the caller.
+class WorkerPool {
+public:
+    static constexpr int32_t maxThreads = 16;
+
+    WorkerPool() = default;
+    ~WorkerPool();
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Threads running jobs, the caller included; 1 runs everything on the caller.
+    // Not thread-safe against run().
+    void setThreads(int32_t count);
+    int32_t getThreads() const { return threads; }
+
+    // Calls job(index, thread) for every index in [0, count), returns when all are done.
+    template <typename Job>
+    void run(int32_t count, Job &job) {
+        dispatch(count, [](void *context, int32_t index, int32_t thread) {
+            (*static_cast<Job *>(context))(index, thread);
+        }, &job);
+    }
+
+private:
+    using Invoke = void (*)(void *context, int32_t index, int32_t thread);
+    // job range of one thread, begin in the low and end in the high 32 bits
+    struct alignas(64) Range {
+        std::atomic<uint64_t> bounds{0};
+    };
+
+    void dispatch(int32_t count, Invoke invoke, void *context);
+    void workerMain(int32_t thread);
+    void work(int32_t thread);
+    bool takeFront(int32_t thread, int32_t &index);
+    bool takeBack(int32_t victim, int32_t &index);
+    void stopWorkers();
+
+    int32_t threads = 1;
+    std::unique_ptr<Range[]> ranges;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    uint64_t generation = 0;            // guarded by mutex, one per run()
+    bool quit = false;                  // guarded by mutex
+    Invoke invoke = nullptr;
+    void *context = nullptr;
+    std::atomic<int32_t> pending{0};    // jobs not finished yet
+    std::atomic<int32_t> busy{0};       // worker threads still inside the current run()
+};
+
+#endif // WORKER_POOL_H
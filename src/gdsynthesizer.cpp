@@ -28,6 +28,7 @@
 
 #include "gdsynthesizer.h"
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/audio_server.hpp>
 
 #if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
 #include <godot_cpp/variant/utility_functions.hpp> // for "UtilityFunctions::print()".
@@ -35,6 +36,7 @@
 
 #include <filesystem>
 
+#include <algorithm>
 #include <cmath>
 #include <new>
 
@@ -45,6 +47,9 @@ void GDSynthesizer::_bind_methods()
     ClassDB::bind_method(D_METHOD("init_synthe", "max_note"), &GDSynthesizer::initSynthe);
     ClassDB::bind_method(D_METHOD("load_midi", "file_path"), &GDSynthesizer::loadMidi);
     ClassDB::bind_method(D_METHOD("unload_midi"), &GDSynthesizer::unloadMidi);
+    ClassDB::bind_method(D_METHOD("seek_midi", "ms"), &GDSynthesizer::seekMidi);
+    ClassDB::bind_method(D_METHOD("get_midi_position"), &GDSynthesizer::getMidiPosition);
+    ClassDB::bind_method(D_METHOD("get_midi_length"), &GDSynthesizer::getMidiLength);
     ClassDB::bind_method(D_METHOD("feed_data", "delta"), &GDSynthesizer::feedData);
 
     ClassDB::bind_method(D_METHOD("set_synthe_params", "p_array"), &GDSynthesizer::setSyntheParams);
@@ -55,9 +60,12 @@ void GDSynthesizer::_bind_methods()
 
     ClassDB::bind_method(D_METHOD("set_control_params", "p_dict"), &GDSynthesizer::setControlParams);
     ClassDB::bind_method(D_METHOD("get_control_params"), &GDSynthesizer::getControlParams);
+    ClassDB::bind_method(D_METHOD("get_render_stats"), &GDSynthesizer::getRenderStats);
 
     ClassDB::bind_method(D_METHOD("set_note_on", "p_dict"), &GDSynthesizer::setNoteOn);
     ClassDB::bind_method(D_METHOD("set_note_off", "p_dict"), &GDSynthesizer::setNoteOff);
+    ClassDB::bind_method(D_METHOD("set_channel_priority", "channel", "priority"), &GDSynthesizer::setChannelPriority);
+    ClassDB::bind_method(D_METHOD("get_sample_clock"), &GDSynthesizer::getSampleClock);
     
     ClassDB::bind_method(D_METHOD("get_mini_wave_picture", "p_dict"), &GDSynthesizer::getMiniWavePicture);
     
@@ -69,91 +77,198 @@ void GDSynthesizer::_bind_methods()
 GDSynthesizer::GDSynthesizer()
 {
 	time_passed = 0;
-    sequencer.emitSignal = std::bind(&GDSynthesizer::emitSignal, this, std::placeholders::_1);
+    // events are raised on the audio thread and emitted by feed_data
+    pendingEvents.reset(eventQueueSize);
+    sequencer.emitSignal = [this](const EmittedEvent &ev) { pendingEvents.push(ev); };
 }
 
 GDSynthesizer::~GDSynthesizer()
 {
+    if (synthStream.is_valid()) {
+        synthStream->detach(); // no mix() after this
+    }
+    detachEngine();
+    renderThread.stop();
     delete [] pcmBuf;
     pcmBuf = nullptr;
 }
 
 int GDSynthesizer::initSynthe(const int32_t max_note)
 {
-    if (!sequencer.initParam(mix_rate, buffer_length/2.0, buf_samples/2)) {
-        return 0;
+    // mix() plays silence while the synth is rebuilt; the thread join, initParam
+    // and the allocations run without mixMutex, so the audio thread never waits
+    suspendMix();
+    renderThread.stop();
+    detachEngine(); // the engine must not render this sequencer during initParam
+    // render at the rate the audio server mixes at, no resampling on the way out
+    mix_rate = (double)AudioServer::get_singleton()->get_mix_rate();
+    buf_samples = int32_t(mix_rate*buffer_length);
+    // max_note sizes the voice pool (clamped to 1 .. Sequencer::maxPolyphony)
+    const bool ready = sequencer.initParam(mix_rate, buffer_length/2.0, buf_samples/2, max_note);
+    float* buffer = ready ? new (std::nothrow) float[buf_samples/2] : nullptr;
+    float* previous = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mixMutex);
+        previous = pcmBuf;
+        pcmBuf = buffer;
+    }
+    delete [] previous;
+    if (buffer == nullptr) {
+        resumeMix(); // silent without a buffer
+        return 0; // initParam or the allocation failed
     }
-    Ref<AudioStreamGenerator> stream;
-    stream.instantiate(); // use Godot allocator (memnew equivalent)
-    set_stream(stream);
-    stream->set_mix_rate(mix_rate);
-    stream->set_buffer_length(buffer_length);
 
-    // Release existing buffer before allocating a new one
-    if (pcmBuf != nullptr) {
-        delete [] pcmBuf;
-        pcmBuf = nullptr;
+    // outside mixMutex: mix() is called with the stream's lock held
+    if (synthStream.is_null()) {
+        synthStream.instantiate(); // use Godot allocator (memnew equivalent)
+        synthStream->attach(this);
     }
-    pcmBuf = new (std::nothrow) double[buf_samples/2];
-    if (pcmBuf == nullptr) {
-        return 0; // Allocation failed
+    if (get_stream() != synthStream) {
+        set_stream(synthStream);
     }
-    frames = PackedVector2Array();
-    frames.resize((int64_t)buf_samples/2);
 
+    applyRenderThread();
+    resumeMix();
     return 1;
 }
 
 void GDSynthesizer::unloadMidi(void)
 {
+    std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
     sequencer.smfUnload();
 }
 
+// Jumps to ms of the song; audio already rendered ahead (render thread ring,
+// engine period) still plays first.
+bool GDSynthesizer::seekMidi(int ms)
+{
+    std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+    return sequencer.smfSeek(ms);
+}
+
+int GDSynthesizer::getMidiPosition(void)
+{
+    std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+    return sequencer.getSongPosition();
+}
+
+int GDSynthesizer::getMidiLength(void)
+{
+    std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+    return sequencer.getSongLength();
+}
+
 int GDSynthesizer::loadMidi(const String &file_path)
 {
-    if(FileAccess::file_exists(file_path)){
-        sequencer.smfLoad(file_path, 60000.0);
+    // native paths are memory-mapped by the parser; res:// and user:// files
+    // (possibly inside a pack) are read in one call and decoded from the buffer.
+    // The song is decoded without the sequencer lock, so the audio thread keeps
+    // rendering the previous one meanwhile, and swapped in under it.
+    const CharString native_path = file_path.utf8();
+    const bool is_native = file_path.is_absolute_path() && !file_path.contains("://");
+    SMFParser parsed;
+    if (is_native && std::filesystem::is_regular_file(native_path.ptr())) {
+        parsed.load(native_path.ptr());
+    }
+    else if(FileAccess::file_exists(file_path)){
+        PackedByteArray bytes = FileAccess::get_file_as_bytes(file_path);
+        parsed.load(bytes.ptr(), (size_t)bytes.size());
     }
-    else if (std::filesystem::is_regular_file(file_path.utf8().ptr())) {
-        sequencer.smfLoad(file_path.utf8().ptr(), 60000.0);
+    else if (std::filesystem::is_regular_file(native_path.ptr())) {
+        parsed.load(native_path.ptr());
     }
     else {
         return 0;
     }
+    {
+        std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+        sequencer.smfAdopt(parsed, 60000.0);
+    }
     return 1;
 }
 
 void GDSynthesizer::feedData(double delta) {
     time_passed += delta;
-    if (is_playing()) {
-        int32_t size = (int32_t)frames.size();
-        Ref<AudioStreamGeneratorPlayback> playback = get_stream_playback();
-        if (playback->can_push_buffer(size)) {
-            sequencer.feed(pcmBuf);
-            for (int32_t i = 0; i < size; i++) {
-                frames[i] = Vector2(pcmBuf[i], pcmBuf[i]);
+    // the audio is rendered by mix(), only the signals of the mixed audio are left here
+    for (const EmittedEvent *ev = pendingEvents.peek(); ev != nullptr; ev = pendingEvents.peek()) {
+        emitSignal(*ev);
+        pendingEvents.pop();
+    }
+}
+
+// Audio thread, called by AudioStreamPlaybackGDSynth::_mix(): renders into the
+// server's buffer in blocks of at most one sequencer buffer, from the ring
+// when the render thread runs, else through the shared RenderEngine, which
+// renders the period of all synthesizers at once.
+void GDSynthesizer::mix(AudioFrame *p_buffer, int32_t p_frames) {
+    // the audio thread mixes every player: silence rather than waiting for init_synthe
+    std::unique_lock<std::mutex> lock(mixMutex, std::try_to_lock);
+    if (!lock.owns_lock() || mixSuspended || pcmBuf == nullptr) {
+        for (int32_t i = 0; i < p_frames; i++) {
+            p_buffer[i].left = p_buffer[i].right = 0.0f;
+        }
+        return;
+    }
+    const int32_t size = buf_samples/2;
+    const bool threaded = renderThread.isRunning();
+    for (int32_t offset = 0; offset < p_frames; offset += size) {
+        int32_t count = std::min(size, p_frames - offset);
+        if (threaded) {
+            renderThread.drain(pcmBuf, count);
+        } else if (engineInstance != nullptr) {
+            RenderEngine::getInstance().pull(engineInstance, pcmBuf, count);
+        } else {
+            // like the engine job: silence rather than waiting for a seek or song swap
+            std::unique_lock<std::mutex> sequencerLock(renderThread.getSequencerMutex(), std::try_to_lock);
+            if (sequencerLock.owns_lock()) {
+                sequencer.feed(pcmBuf, count);
+            } else {
+                std::fill(pcmBuf, pcmBuf + count, 0.0f);
             }
-            playback->push_buffer(frames);
+        }
+        AudioFrame *out = p_buffer + offset;
+        for (int32_t i = 0; i < count; i++) {
+            out[i].left = out[i].right = pcmBuf[i];
         }
     }
 }
 
 
-void GDSynthesizer::emitSignal(const godot::Dictionary dic) {
-    if ((int32_t)dic["msg"] == 0){
-        if ((int32_t)dic["onOff"] == 1){
+void GDSynthesizer::emitSignal(const EmittedEvent &ev) {
+    Dictionary dic;
+    dic["msg"] = ev.msg;
+    if (ev.msg == 0 || ev.msg == 2) {
+        // msg == 0: normal note_on/note_off
+        // msg == 2: pre-on signal
+        dic["onOff"]         = ev.note.onOff;
+        dic["trackNum"]      = ev.note.trackNum;
+        dic["channel"]       = ev.note.channel;
+        dic["velocity"]      = ev.note.velocity;
+        dic["program"]       = ev.note.program;
+        dic["key"]           = ev.note.key;
+        dic["instrumentNum"] = ev.note.instrumentNum;
+        dic["key2"]          = ev.note.key2;
+    } else if (ev.msg == 1) {
+        dic["max_level"]        = ev.level.max_level;
+        dic["frame_level"]      = ev.level.frame_level;
+        dic["rendered_samples"] = ev.level.rendered_samples;
+        dic["skipped_samples"]  = ev.level.skipped_samples;
+    }
+
+    if (ev.msg == 0){
+        if (ev.note.onOff == 1){
             emit_signal("note_changed", "note_on", dic);
         }
         else{
             emit_signal("note_changed", "note_off", dic);
         }
     }
-    else if ((int32_t)dic["msg"] == 1){
+    else if (ev.msg == 1){
         emit_signal("level_info", dic);
     }
-    else if ((int32_t)dic["msg"] == 2){
+    else if (ev.msg == 2){
         // pre-on signal
-        if ((int32_t)dic["onOff"] == 1){
+        if (ev.note.onOff == 1){
             emit_signal("pre_note_changed", "pre_note_on", dic);
         }
         else{
@@ -164,39 +279,369 @@ void GDSynthesizer::emitSignal(const godot::Dictionary dic) {
 
 
 void GDSynthesizer::setSyntheParams(const Array p_array) {
-    sequencer.setInstruments(p_array);
+    if (p_array.size() != Sequencer::numinstruments) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        UtilityFunctions::print("Error in setInstruments(): array size error, ", p_array.size());
+#endif // DEBUG_ENABLED
+    }
+    // values are range-checked by Sequencer::setInstruments()
+    std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+    auto instruments = sequencer.getInstruments();
+    for (int32_t i = 0; i < Sequencer::numinstruments; i++) {
+        Dictionary dic = p_array[i];
+
+        instruments[i].totalGain          = (float)(double)dic["totalGain"];
+        instruments[i].atackSlopeTime     = (float)(double)dic["atackSlopeTime"];
+        instruments[i].decayHalfLifeTime  = (float)(double)dic["decayHalfLifeTime"];
+        instruments[i].sustainRate        = (float)(double)dic["sustainRate"];
+        instruments[i].releaseSlopeTime   = (float)(double)dic["releaseSlopeTime"];
+
+        instruments[i].baseVsOthersRatio  = (float)(double)dic["baseVsOthersRatio"];
+        instruments[i].side1VsSide2Ratio  = (float)(double)dic["side1VsSide2Ratio"];
+        instruments[i].baseOffsetCent1    = (float)(double)dic["baseOffsetCent1"];
+        instruments[i].baseWave1          = static_cast<BaseWave>((int32_t)dic["baseWave1"]);
+        instruments[i].baseOffsetCent2    = (float)(double)dic["baseOffsetCent2"];
+        instruments[i].baseWave2          = static_cast<BaseWave>((int32_t)dic["baseWave2"]);
+        instruments[i].baseOffsetCent3    = (float)(double)dic["baseOffsetCent3"];
+        instruments[i].baseWave3          = static_cast<BaseWave>((int32_t)dic["baseWave3"]);
+
+        instruments[i].noiseRatio         = (float)(double)dic["noiseRatio"];
+        instruments[i].noiseColorType     = static_cast<NoiseColorType>((int32_t)dic["noiseColorType"]);
+
+        instruments[i].delay0Time         = (float)(double)dic["delay0Time"];
+        instruments[i].delay1Time         = (float)(double)dic["delay1Time"];
+        instruments[i].delay2Time         = (float)(double)dic["delay2Time"];
+        instruments[i].delay0Ratio        = (float)(double)dic["delay0Ratio"];
+        instruments[i].delay1Ratio        = (float)(double)dic["delay1Ratio"];
+        instruments[i].delay2Ratio        = (float)(double)dic["delay2Ratio"];
+
+        instruments[i].freqNoiseCentRange = (float)(double)dic["freqNoiseCentRange"];
+        instruments[i].freqNoiseType      = static_cast<NoiseDistributType>((int32_t)dic["freqNoiseType"]);
+
+        instruments[i].fmCentRange        = (float)(double)dic["fmCentRange"];
+        instruments[i].fmFreq             = (float)(double)dic["fmFreq"];
+        instruments[i].fmPhaseOffset      = (float)(double)dic["fmPhaseOffset"];
+        instruments[i].fmSync             = (int32_t)dic["fmSync"];
+        instruments[i].fmWave             = static_cast<BaseWave>((int32_t)dic["fmWave"]);
+
+        instruments[i].amLevel            = (float)(double)dic["amLevel"];
+        instruments[i].amFreq             = (float)(double)dic["amFreq"];
+        instruments[i].amPhaseOffset      = (float)(double)dic["amPhaseOffset"];
+        instruments[i].amSync             = (int32_t)dic["amSync"];
+        instruments[i].amWave             = static_cast<BaseWave>((int32_t)dic["amWave"]);
+
+        // optional: older instrument dictionaries have no delayPerVoice key
+        instruments[i].delayPerVoice      = dic.has("delayPerVoice") ? (int32_t)dic["delayPerVoice"] : 0;
+    }
+    sequencer.setInstruments(instruments);
 }
 
 Array GDSynthesizer::getSyntheParams(void) {
-    return sequencer.getInstruments();
+    const auto& instruments = sequencer.getInstruments();
+    Array array;
+    for (int32_t i = 0; i < Sequencer::numinstruments; i++) {
+        Dictionary dic;
+
+        dic["totalGain"]          = instruments[i].totalGain;
+
+        dic["atackSlopeTime"]     = instruments[i].atackSlopeTime;
+        dic["decayHalfLifeTime"]  = instruments[i].decayHalfLifeTime;
+        dic["sustainRate"]        = instruments[i].sustainRate;
+        dic["releaseSlopeTime"]   = instruments[i].releaseSlopeTime;
+
+        dic["baseVsOthersRatio"]  = instruments[i].baseVsOthersRatio;
+        dic["side1VsSide2Ratio"]  = instruments[i].side1VsSide2Ratio;
+        dic["baseOffsetCent1"]    = instruments[i].baseOffsetCent1;
+        dic["baseWave1"]          = static_cast<int32_t>(instruments[i].baseWave1);
+        dic["baseOffsetCent2"]    = instruments[i].baseOffsetCent2;
+        dic["baseWave2"]          = static_cast<int32_t>(instruments[i].baseWave2);
+        dic["baseOffsetCent3"]    = instruments[i].baseOffsetCent3;
+        dic["baseWave3"]          = static_cast<int32_t>(instruments[i].baseWave3);
+
+        dic["noiseRatio"]         = instruments[i].noiseRatio;
+        dic["noiseColorType"]     = static_cast<int32_t>(instruments[i].noiseColorType);
+
+        dic["delay0Time"]         = instruments[i].delay0Time;
+        dic["delay1Time"]         = instruments[i].delay1Time;
+        dic["delay2Time"]         = instruments[i].delay2Time;
+        dic["delay0Ratio"]        = instruments[i].delay0Ratio;
+        dic["delay1Ratio"]        = instruments[i].delay1Ratio;
+        dic["delay2Ratio"]        = instruments[i].delay2Ratio;
+
+        dic["freqNoiseCentRange"] = instruments[i].freqNoiseCentRange;
+        dic["freqNoiseType"]      = static_cast<int32_t>(instruments[i].freqNoiseType);
+
+        dic["fmCentRange"]        = instruments[i].fmCentRange;
+        dic["fmFreq"]             = instruments[i].fmFreq;
+        dic["fmPhaseOffset"]      = instruments[i].fmPhaseOffset;
+        dic["fmSync"]             = instruments[i].fmSync;
+        dic["fmWave"]             = static_cast<int32_t>(instruments[i].fmWave);
+
+        
+        dic["amLevel"]            = instruments[i].amLevel;
+        dic["amFreq"]             = instruments[i].amFreq;
+        dic["amPhaseOffset"]      = instruments[i].amPhaseOffset;
+        dic["amSync"]             = instruments[i].amSync;
+        dic["amWave"]             = static_cast<int32_t>(instruments[i].amWave);
+
+        dic["delayPerVoice"]      = instruments[i].delayPerVoice;
+
+        array.push_back(dic);
+    }
+    return array;
 }
 
 void GDSynthesizer::setPercussionParams(const Array p_array) {
-    sequencer.setPercussions(p_array);
+    if (p_array.size() != Sequencer::numPercussions) {
+#if defined(DEBUG_ENABLED) && defined(WINDOWS_ENABLED)
+        UtilityFunctions::print("Error in setPercussions(): array size error, ", p_array.size());
+#endif // DEBUG_ENABLED
+    }
+    std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+    auto percussions = sequencer.getPercussions();
+    for (int32_t i = 0; i < Sequencer::numPercussions; i++) {
+        Dictionary dic = p_array[i];
+        percussions[i].program = (int32_t)dic["program"];
+        percussions[i].key     = (int32_t)dic["key"];
+    }
+    sequencer.setPercussions(percussions);
 }
 
 Array GDSynthesizer::getPercussionParams(void) {
-    return sequencer.getPercussions();
+    const auto& percussions = sequencer.getPercussions();
+    Array array;
+    for (int32_t i = 0; i < Sequencer::numPercussions; i++) {
+        Dictionary dic;
+
+        dic["program"]  = percussions[i].program;
+        dic["key"]      = percussions[i].key;
+        array.push_back(dic);
+    }
+    return array;
+}
+
+static Note noteFromDictionary(const Dictionary &dic) {
+    Note oneNote;
+    oneNote.trackNum  = 0;
+    oneNote.channel   = (int32_t)dic["channel"];
+    oneNote.key       = (int32_t)dic["key"];
+    oneNote.velocity  = (int32_t)dic["velocity"];
+    oneNote.program   = (int32_t)dic["program"];
+    oneNote.startTick = 0;
+    oneNote.startTime = 0;
+    oneNote.tempo     = (int32_t)dic["tempo"];
+    return oneNote;
+}
+
+// Live input is queued without locking and played by the audio thread at
+// its sample: "sample_time" (see get_sample_clock) or, without it, a fixed
+// latency after the call.
+static int64_t sampleTimeFromDictionary(const Dictionary &dic) {
+    return dic.has("sample_time") ? (int64_t)dic["sample_time"] : -1;
 }
 
 void GDSynthesizer::setNoteOn(const Dictionary p_dic) {
-    sequencer.incertNoteOn(p_dic);
+    sequencer.incertNoteOn(noteFromDictionary(p_dic), sampleTimeFromDictionary(p_dic));
 }
 
 void GDSynthesizer::setNoteOff(const Dictionary p_dic) {
-    sequencer.incertNoteOff(p_dic);
+    sequencer.incertNoteOff(noteFromDictionary(p_dic), sampleTimeFromDictionary(p_dic));
+}
+
+void GDSynthesizer::setChannelPriority(const int32_t channel, const int32_t priority) {
+    sequencer.postChannelPriority(channel, priority);
+}
+
+int64_t GDSynthesizer::getSampleClock(void) {
+    return sequencer.getSampleClock();
 }
 
 void GDSynthesizer::setControlParams(const Dictionary p_dic) {
-    sequencer.setControlParams(p_dic);
+    ControlParams params;
+    params.divisionNum = (float)(double)p_dic["divisionNum"];
+    params.logLevel = (int32_t)p_dic["logLevel"];
+    if (p_dic.has("preOnTime")) {
+        params.preOnTime = (float)(double)p_dic["preOnTime"];
+    } else {
+        params.preOnTime = 0.0f; // Default: disabled
+    }
+    if (p_dic.has("renderKernel")) {
+        params.renderKernel = static_cast<RenderKernel>((int32_t)p_dic["renderKernel"]);
+    }
+    if (p_dic.has("masterKnee")) {
+        params.masterKnee = (float)(double)p_dic["masterKnee"];
+    }
+    if (p_dic.has("controlRate")) {
+        params.controlRate = (int32_t)p_dic["controlRate"];
+    }
+    if (p_dic.has("renderThreads")) {
+        params.renderThreads = (int32_t)p_dic["renderThreads"];
+    }
+    if (p_dic.has("cullLevel")) {
+        params.cullLevel = (float)(double)p_dic["cullLevel"];
+    }
+    if (p_dic.has("engineThreads")) {
+        // process-wide: threads of the engine shared by all synthesizers
+        RenderEngine::getInstance().setThreads((int32_t)p_dic["engineThreads"]);
+    }
+    {
+        std::lock_guard<std::mutex> lock(renderThread.getSequencerMutex());
+        sequencer.setControlParams(params);
+    }
+    if (p_dic.has("renderThread")) {
+        useRenderThread = ((int32_t)p_dic["renderThread"] != 0);
+    }
+    if (p_dic.has("ringDepthMs")) {
+        ringDepthMs = std::clamp((int32_t)p_dic["ringDepthMs"], RenderThread::minDepthMs, RenderThread::maxDepthMs);
+    }
+    if (renderPathChanges()) {
+        suspendMix();
+        applyRenderThread();
+        resumeMix();
+    }
 }
 
 Dictionary GDSynthesizer::getControlParams(void) {
-    return sequencer.getControlParams();
+    ControlParams params = sequencer.getControlParams();
+    Dictionary dic;
+    dic["divisionNum"] = params.divisionNum;
+    dic["logLevel"] = params.logLevel;
+    dic["preOnTime"] = params.preOnTime;
+    dic["renderKernel"] = static_cast<int32_t>(params.renderKernel);
+    dic["masterKnee"] = params.masterKnee;
+    dic["controlRate"] = params.controlRate;
+    dic["renderThreads"] = params.renderThreads;
+    dic["cullLevel"] = params.cullLevel;
+    dic["engineThreads"] = RenderEngine::getInstance().getThreads();
+    dic["renderThread"] = useRenderThread ? 1 : 0;
+    dic["ringDepthMs"] = ringDepthMs;
+    return dic;
+}
+
+// mix() plays silence from suspendMix() to resumeMix(), so the render thread,
+// the engine and pcmBuf can be changed without holding mixMutex meanwhile.
+void GDSynthesizer::suspendMix() {
+    std::lock_guard<std::mutex> lock(mixMutex);
+    mixSuspended = true;
+}
+
+void GDSynthesizer::resumeMix() {
+    std::lock_guard<std::mutex> lock(mixMutex);
+    mixSuspended = false;
+}
+
+// Whether applyRenderThread() has anything to start, stop or attach.
+bool GDSynthesizer::renderPathChanges() const {
+    if (!useRenderThread || pcmBuf == nullptr) {
+        return renderThread.isRunning() || (engineInstance == nullptr && pcmBuf != nullptr);
+    }
+    return !renderThread.isRunning() || renderThread.getDepthMs() != ringDepthMs;
+}
+
+// Starts, restarts (new depth) or stops the render thread to match the
+// control params. Before init_synthe there is nothing to render yet.
+// Called while mix() is suspended.
+void GDSynthesizer::applyRenderThread() {
+    if (!useRenderThread || pcmBuf == nullptr) {
+        renderThread.stop();
+        attachEngine();
+        return;
+    }
+    if (renderThread.isRunning() && renderThread.getDepthMs() == ringDepthMs) {
+        return;
+    }
+    detachEngine(); // the render thread feeds the sequencer itself
+    if (!renderThread.start(ringDepthMs)) {
+        attachEngine(); // threads are unavailable: mix() renders as before
+    }
+}
+
+// Called while mix() is suspended.
+void GDSynthesizer::attachEngine() {
+    if (engineInstance == nullptr && pcmBuf != nullptr) {
+        engineInstance = RenderEngine::getInstance().attach(sequencer, renderThread.getSequencerMutex(), buf_samples/2);
+    }
+}
+
+void GDSynthesizer::detachEngine() {
+    RenderEngine::getInstance().detach(engineInstance);
+    engineInstance = nullptr;
+}
+
+Dictionary GDSynthesizer::getRenderStats(void) {
+    RenderStats stats = renderThread.getStats();
+    Dictionary dic;
+    dic["running"]          = renderThread.isRunning();
+    dic["rendered_buffers"] = stats.renderedBuffers;
+    dic["underruns"]        = stats.underruns;
+    dic["underrun_frames"]  = stats.underrunFrames;
+    dic["dropped_events"]   = stats.droppedEvents;
+    dic["depth_frames"]     = stats.depthFrames;
+    dic["buffered_frames"]  = stats.bufferedFrames;
+    dic["priority_raised"]  = stats.priorityRaised;
+    LiveInputStats live = sequencer.getLiveInputStats();
+    dic["live_applied"]     = live.applied;
+    dic["live_late"]        = live.late;
+    dic["live_dropped"]     = live.dropped;
+    EngineStats engine = RenderEngine::getInstance().getStats();
+    dic["engine_instances"] = engine.instances;
+    dic["engine_threads"]   = engine.threads;
+    dic["engine_batches"]   = engine.batches;
+    dic["engine_silent_frames"] = engine.silentFrames;
+    return dic;
 }
 
 Ref<Image> GDSynthesizer::getMiniWavePicture(const Dictionary p_dic) {
-    return sequencer.getMiniWavePicture(p_dic);
+    int32_t size_x = p_dic["size_x"];
+    int32_t size_y = p_dic["size_y"];
+    int32_t type = p_dic["type"];
+    int32_t phase = p_dic["phase"];
+    if (size_x > 400) size_x = 400;
+    if (size_x < 16) size_x = 16;
+    if (size_y > 400) size_y = 400;
+    if (size_y < 16) size_y = 16;
+    float invert = 1.0f;
+    if (type == static_cast<int32_t>(BaseWave::WAVE_TAIL)){
+        type = static_cast<int32_t>(BaseWave::WAVE_SAWTOOTH);
+        invert = -1.0f;
+    }
+    if (type > static_cast<int32_t>(BaseWave::WAVE_TAIL)) type = 0;
+    if (type < 0) type = 0;
+    if (phase > 360) phase = 360;
+    if (phase == 360) phase = 0;
+    if (phase < 0) phase = 0;
+    phase = (int32_t)((double)phase/360.0*(double)size_x);
+
+    Ref<Image> miniWaveImage;
+
+    miniWaveImage = Image::create(size_x, size_y, false, Image::FORMAT_RGBA8);
+    miniWaveImage->fill(Color(0.2, 0.2, 0.2, 1.0));
+    auto& lut = SharedLUT::getInstance();
+    const auto& waveLUT = lut.getWaveLUT();
+    int32_t s = SharedLUT::getWaveLUTSize();
+    
+    int32_t pre_y;
+    for (int32_t i = 0; i < size_x; i++){
+        int32_t x = (int32_t)(double((i+phase)%size_x)/double(size_x)*double(s));
+        float fy = (1.0f-waveLUT[type][x]*invert)/2.0f;
+        if (fy >= 1.0f) fy = 0.99f;
+        if (fy <= 0.0f) fy = 0.01f;
+        int32_t y = (int32_t)(fy*(float)size_y);
+        if (i == 0) pre_y = y;
+        if (y < pre_y){
+            for (int32_t j = y; j <= pre_y; j++){
+                miniWaveImage->set_pixel(i, j, Color(1.0, 0.5, 0.0, 1.0));
+            }
+        }
+        else{
+            for (int32_t j = pre_y; j <= y; j++){
+                miniWaveImage->set_pixel(i, j, Color(1.0, 0.5, 0.0 , 1.0));
+            }
+        }
+        
+        pre_y = y;
+    }
+    return miniWaveImage;
 }
 
 
@@ -30,36 +30,56 @@
 #ifndef GDSYNTHESIZER_H
 #define GDSYNTHESIZER_H
 #include <godot_cpp/classes/audio_stream_player.hpp>
-#include <godot_cpp/classes/audio_stream_generator.hpp>
-#include <godot_cpp/classes/audio_stream_generator_playback.hpp>
 #include <godot_cpp/classes/image.hpp>
 #include <godot_cpp/classes/file_access.hpp>
 #include <functional>
 
 #include "sequencer.hpp"
+#include "render_thread.hpp"
+#include "render_engine.hpp"
+#include "spsc_ring.hpp"
+#include "audio_stream_gdsynth.h"
 
 namespace godot {
 
 class GDSynthesizer : public AudioStreamPlayer {
     GDCLASS(GDSynthesizer, AudioStreamPlayer);
 
-    static constexpr double mix_rate = 44100.0; // Sampling freq. It's also the samples num per sec.
     static constexpr double buffer_length = 0.1; // Buffer length in seconds.
+    static constexpr int32_t eventQueueSize = 4096;
 
+    double mix_rate = 44100.0; // Sampling freq, the audio server's mix rate after init_synthe.
     int32_t buf_samples = int32_t(mix_rate*buffer_length);
     double time_passed;
-    PackedVector2Array frames;
+    bool useRenderThread = false;
+    int32_t ringDepthMs = RenderThread::defaultDepthMs;
+    Ref<AudioStreamGDSynth> synthStream;
+    std::mutex mixMutex;              // mix() against the switch of pcmBuf and mixSuspended
+    bool mixSuspended = false;        // mix() plays silence, the render paths are being changed
+    SpscRing<EmittedEvent> pendingEvents; // raised on the audio thread, emitted by feed_data
+    RenderEngine::Instance *engineInstance = nullptr; // rendered by the shared engine, without the render thread
+    void suspendMix();
+    void resumeMix();
+    bool renderPathChanges() const;
+    void applyRenderThread();
+    void attachEngine();
+    void detachEngine();
 protected:
     static void _bind_methods();
 public:
-    double* pcmBuf = nullptr;
+    float* pcmBuf = nullptr;
     Sequencer sequencer;
+    RenderThread renderThread{sequencer}; // after sequencer: stops before it is destroyed
     GDSynthesizer();
     ~GDSynthesizer();
     void feedData(double delta);
+    void mix(AudioFrame *p_buffer, int32_t p_frames);
     int initSynthe(const int32_t max_note);
     int loadMidi(const String &p_file);
     void unloadMidi(void);
+    bool seekMidi(int ms);
+    int getMidiPosition(void);
+    int getMidiLength(void);
     void setSyntheParams(const Array);
     Array getSyntheParams(void);
 
@@ -68,12 +88,15 @@ public:
 
     void setControlParams(const Dictionary);
     Dictionary getControlParams(void);
+    Dictionary getRenderStats(void);
 
     void setNoteOn(const Dictionary);
     void setNoteOff(const Dictionary);
+    void setChannelPriority(const int32_t, const int32_t);
+    int64_t getSampleClock(void);
     Ref<Image> getMiniWavePicture(const Dictionary);
     
-    void emitSignal(const godot::Dictionary dic);
+    void emitSignal(const EmittedEvent &ev);
 };
 }
 
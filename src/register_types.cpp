@@ -1,20 +1,31 @@
 #include "register_types.h"
 
 #include "gdsynthesizer.h"
+#include "audio_stream_gdsynth.h"
+#include "debug_print.hpp"
 
 #include <gdextension_interface.h>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/godot.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace godot;
 
+static void print_to_godot(const char *line)
+{
+    UtilityFunctions::print(String::utf8(line));
+}
+
 void initialize_gdsynthesizer_module(ModuleInitializationLevel p_level)
 {
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
     }
 
+    gdsynth::setPrintSink(print_to_godot);
+    ClassDB::register_class<AudioStreamGDSynth>();
+    ClassDB::register_class<AudioStreamPlaybackGDSynth>();
     ClassDB::register_class<GDSynthesizer>();
 }
 
@@ -23,6 +34,7 @@ void uninitialize_gdsynthesizer_module(ModuleInitializationLevel p_level)
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
     }
+    gdsynth::setPrintSink(nullptr);
 }
 
 extern "C" {